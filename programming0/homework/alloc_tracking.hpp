@@ -0,0 +1,195 @@
+#ifndef ALLOC_TRACKING_HPP
+#define ALLOC_TRACKING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+/// Optionale Zaehlung aller Heap-Allokationen.
+///
+/// Ein Programm schaltet die Zaehlung ein, indem es in genau einer
+/// Uebersetzungseinheit vor dem Einbinden dieser Datei (oder per
+/// Compiler-Flag) `ALLOC_TRACKING_REPLACE_NEW` definiert. Dann werden die
+/// globalen `operator new`/`operator delete` ersetzt und jede Allokation wird
+/// in Zaehlern des allozierenden Threads verbucht. Ohne die Ersetzung bleiben
+/// alle Zaehler 0 und `alloc_tracking::enabled()` gibt `false` zurueck.
+/// Da jede Allokation dann einen Header und die Zaehlung kostet, gehoert die
+/// Ersetzung nicht in Programme, die Laufzeiten messen (siehe sort_memory).
+///
+/// Freigaben werden dem freigebenden Thread zugerechnet; die Zaehler eines
+/// Threads sind also nur dann aussagekraeftig, wenn eine Phase ihren
+/// Speicher selbst anlegt und freigibt (wie die sequentiellen Phasen in
+/// sort.cpp).
+///
+/// # Example
+/// ```c++
+/// #define ALLOC_TRACKING_REPLACE_NEW
+/// #include "alloc_tracking.hpp"
+///
+/// AllocPhase phase;
+/// lst.sort();
+/// AllocCounters counters = phase.finish();
+/// assert(counters.allocations == 0);
+/// ```
+
+/// Zaehler einer Phase bzw. eines Threads.
+struct AllocCounters {
+  uint64_t allocations{0};
+  uint64_t frees{0};
+  uint64_t allocated_bytes{0};
+  uint64_t freed_bytes{0};
+  /// Hoechster Stand der lebenden Bytes, relativ zum Beginn der Phase.
+  uint64_t peak_bytes{0};
+
+  /// Aenderung der lebenden Bytes (negativ, falls mehr frei wurde).
+  int64_t live_bytes() const {
+    return static_cast<int64_t>(allocated_bytes) -
+           static_cast<int64_t>(freed_bytes);
+  }
+};
+
+namespace alloc_tracking {
+
+/// Zaehler des aktuellen Threads. Absichtlich trivial, damit der Zugriff aus
+/// `operator new` keine Initialisierung (und damit Allokation) ausloest.
+struct ThreadState {
+  AllocCounters counters;
+  int64_t live{0};
+  int64_t peak{0};
+};
+
+inline thread_local ThreadState state;
+
+/// Wird von den ersetzten Operatoren auf `true` gesetzt.
+inline bool installed = false;
+
+inline bool enabled() { return installed; }
+
+inline void record_allocation(size_t bytes) {
+  ThreadState &s = state;
+  ++s.counters.allocations;
+  s.counters.allocated_bytes += bytes;
+  s.live += static_cast<int64_t>(bytes);
+  s.peak = std::max(s.peak, s.live);
+}
+
+inline void record_free(size_t bytes) {
+  ThreadState &s = state;
+  ++s.counters.frees;
+  s.counters.freed_bytes += bytes;
+  s.live -= static_cast<int64_t>(bytes);
+}
+
+} // namespace alloc_tracking
+
+/// Misst die Allokationen des aktuellen Threads zwischen Konstruktion und
+/// `finish()`. Phasen duerfen nicht verschachtelt werden, da jede Phase den
+/// Spitzenwert des Threads zuruecksetzt.
+class AllocPhase {
+public:
+  AllocPhase() {
+    alloc_tracking::ThreadState &s = alloc_tracking::state;
+    start = s.counters;
+    start_live = s.live;
+    s.peak = s.live;
+  }
+
+  /// Gibt die Zaehler seit Beginn der Phase zurueck.
+  AllocCounters finish() const {
+    const alloc_tracking::ThreadState &s = alloc_tracking::state;
+    AllocCounters result;
+    result.allocations = s.counters.allocations - start.allocations;
+    result.frees = s.counters.frees - start.frees;
+    result.allocated_bytes = s.counters.allocated_bytes - start.allocated_bytes;
+    result.freed_bytes = s.counters.freed_bytes - start.freed_bytes;
+    result.peak_bytes = static_cast<uint64_t>(s.peak - start_live);
+    return result;
+  }
+
+private:
+  AllocCounters start;
+  int64_t start_live;
+};
+
+#ifdef ALLOC_TRACKING_REPLACE_NEW
+
+namespace alloc_tracking {
+
+// Vor jedem Block liegt ein Header mit der angeforderten Groesse. Er ist so
+// gross wie die Ausrichtung des Blocks, damit der Nutzbereich ausgerichtet
+// bleibt.
+inline void *tracked_allocate(size_t bytes, size_t alignment) {
+  alignment = std::max(alignment, alignof(std::max_align_t));
+  const size_t total = (bytes + 2 * alignment - 1) / alignment * alignment;
+  void *raw = std::aligned_alloc(alignment, total);
+  if (!raw) {
+    throw std::bad_alloc();
+  }
+  *static_cast<size_t *>(raw) = bytes;
+  record_allocation(bytes);
+  return static_cast<char *>(raw) + alignment;
+}
+
+inline void tracked_free(void *ptr, size_t alignment) noexcept {
+  if (!ptr) {
+    return;
+  }
+  alignment = std::max(alignment, alignof(std::max_align_t));
+  void *raw = static_cast<char *>(ptr) - alignment;
+  record_free(*static_cast<size_t *>(raw));
+  std::free(raw);
+}
+
+struct Installer {
+  Installer() { installed = true; }
+};
+inline Installer installer;
+
+} // namespace alloc_tracking
+
+void *operator new(size_t bytes) {
+  return alloc_tracking::tracked_allocate(bytes, 0);
+}
+void *operator new[](size_t bytes) {
+  return alloc_tracking::tracked_allocate(bytes, 0);
+}
+void *operator new(size_t bytes, std::align_val_t alignment) {
+  return alloc_tracking::tracked_allocate(bytes,
+                                          static_cast<size_t>(alignment));
+}
+void *operator new[](size_t bytes, std::align_val_t alignment) {
+  return alloc_tracking::tracked_allocate(bytes,
+                                          static_cast<size_t>(alignment));
+}
+
+void operator delete(void *ptr) noexcept {
+  alloc_tracking::tracked_free(ptr, 0);
+}
+void operator delete[](void *ptr) noexcept {
+  alloc_tracking::tracked_free(ptr, 0);
+}
+void operator delete(void *ptr, size_t) noexcept {
+  alloc_tracking::tracked_free(ptr, 0);
+}
+void operator delete[](void *ptr, size_t) noexcept {
+  alloc_tracking::tracked_free(ptr, 0);
+}
+void operator delete(void *ptr, std::align_val_t alignment) noexcept {
+  alloc_tracking::tracked_free(ptr, static_cast<size_t>(alignment));
+}
+void operator delete[](void *ptr, std::align_val_t alignment) noexcept {
+  alloc_tracking::tracked_free(ptr, static_cast<size_t>(alignment));
+}
+void operator delete(void *ptr, size_t, std::align_val_t alignment) noexcept {
+  alloc_tracking::tracked_free(ptr, static_cast<size_t>(alignment));
+}
+void operator delete[](void *ptr, size_t,
+                       std::align_val_t alignment) noexcept {
+  alloc_tracking::tracked_free(ptr, static_cast<size_t>(alignment));
+}
+
+#endif // ALLOC_TRACKING_REPLACE_NEW
+
+#endif // ALLOC_TRACKING_HPP
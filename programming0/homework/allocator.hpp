@@ -0,0 +1,234 @@
+#ifndef ALLOCATOR_HPP
+#define ALLOCATOR_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+/// Allokator-Policies fuer die Knoten von `BasicList`.
+///
+/// Jede Policy stellt `allocate()` (roher Speicher fuer genau einen Knoten)
+/// und `deallocate(p)` bereit. `allocate_bulk(n, construct)` ruft
+/// `construct(p)` nacheinander fuer `n` frische Knoten auf, die die Policy
+/// moeglichst zusammenhaengend vergibt. Zusaetzlich gibt `supports_reset` an,
+/// ob alle Knoten auf einmal freigegeben werden koennen (`reset()`); solche
+/// Policies zaehlen mit `live_nodes()` die vergebenen, noch nicht
+/// freigegebenen Knoten. `merge(other)` erlaubt es Knoten zwischen Listen mit
+/// verschiedenen Allokatoren zu verschieben.
+
+/// Allokiert jeden Knoten einzeln mittels `operator new` / `operator delete`.
+/// Entspricht dem urspruenglichen Verhalten der Liste und dient als Vergleich.
+template <typename Node> class HeapAllocator {
+public:
+  static constexpr bool supports_reset = false;
+
+  void *allocate() { return ::operator new(sizeof(Node)); }
+
+  void deallocate(void *ptr) { ::operator delete(ptr); }
+
+  /// Jeder Knoten muss einzeln freigegeben werden koennen, daher wird auch
+  /// hier jeder Knoten einzeln angelegt.
+  template <typename Construct>
+  void allocate_bulk(size_t n, Construct &&construct) {
+    for (size_t i = 0; i < n; ++i) {
+      void *ptr = allocate();
+      try {
+        construct(ptr);
+      } catch (...) {
+        deallocate(ptr);
+        throw;
+      }
+    }
+  }
+
+  /// Knoten aus verschiedenen Heap-Allokatoren sind austauschbar.
+  void merge(HeapAllocator &) {}
+};
+
+/// Arena-Allokator: Knoten werden aus zusammenhaengenden Chunks mit je
+/// `NodesPerChunk` Plaetzen vergeben; freigegebene Knoten landen in einer
+/// Freiliste und werden bei der naechsten Allokation wiederverwendet.
+/// `reset()` gibt alle Knoten in O(1) frei (die Chunks bleiben erhalten).
+///
+/// Werden Knoten zwischen Listen mit verschiedenen Arenen verschoben, so
+/// werden die Arenen mittels `merge` verschmolzen: Die Wurzel-Arena uebernimmt
+/// alle Chunks, die andere Arena leitet danach alle Anfragen an sie weiter
+/// (wie bei Union-Find). Damit bleibt jeder Knoten solange gueltig, wie
+/// irgendeine Liste eine der verschmolzenen Arenen referenziert.
+///
+/// # Example
+/// ```c++
+/// auto arena = std::make_shared<ArenaAllocator<List::Item>>();
+/// List a(arena), b(arena); // a und b teilen sich die Arena
+/// ```
+template <typename Node, size_t NodesPerChunk = 1024>
+class ArenaAllocator
+    : public std::enable_shared_from_this<ArenaAllocator<Node, NodesPerChunk>> {
+public:
+  static constexpr bool supports_reset = true;
+
+  ArenaAllocator() = default;
+  ArenaAllocator(const ArenaAllocator &) = delete;
+  ArenaAllocator &operator=(const ArenaAllocator &) = delete;
+
+  void *allocate() {
+    if (parent)
+      return root()->allocate();
+
+    if (free_list) {
+      Slot *slot = free_list;
+      free_list = slot->next_free;
+      ++num_live;
+      return slot;
+    }
+
+    if (bump == bump_end)
+      next_chunk();
+
+    ++num_live;
+    return bump++;
+  }
+
+  /// Vergibt `n` Knoten direkt hintereinander aus den Chunks (eine
+  /// Systemallokation pro `NodesPerChunk` Knoten). Die Freiliste wird dabei
+  /// bewusst uebergangen, damit aufeinanderfolgende Knoten auch im Speicher
+  /// benachbart sind. Wirft `construct`, bleibt der betroffene Platz frei.
+  template <typename Construct>
+  void allocate_bulk(size_t n, Construct &&construct) {
+    if (parent)
+      return root()->allocate_bulk(n, construct);
+
+    while (n > 0) {
+      if (bump == bump_end)
+        next_chunk();
+      const size_t run = std::min<size_t>(n, bump_end - bump);
+      for (size_t i = 0; i < run; ++i) {
+        construct(static_cast<void *>(bump));
+        ++bump;
+        ++num_live;
+      }
+      n -= run;
+    }
+  }
+
+  void deallocate(void *ptr) {
+    if (parent)
+      return root()->deallocate(ptr);
+
+    Slot *slot = static_cast<Slot *>(ptr);
+    --num_live;
+    slot->next_free = free_list;
+    if (!free_list)
+      free_tail = slot;
+    free_list = slot;
+  }
+
+  /// Gibt alle Knoten auf einmal frei. Darf nur auf einer Wurzel-Arena
+  /// aufgerufen werden, die von keiner anderen Liste mehr genutzt wird und
+  /// deren Knoten auch sonst niemand mehr haelt (siehe `live_nodes`).
+  void reset() {
+    assert(is_root());
+    if (spare_chunks.empty()) {
+      spare_chunks.swap(chunks);
+    } else {
+      spare_chunks.reserve(spare_chunks.size() + chunks.size());
+      for (auto &chunk : chunks)
+        spare_chunks.push_back(std::move(chunk));
+      chunks.clear();
+    }
+    free_list = free_tail = nullptr;
+    bump = bump_end = nullptr;
+    num_live = 0;
+  }
+
+  /// Anzahl der vergebenen und noch nicht freigegebenen Knoten aller
+  /// verschmolzenen Arenen.
+  size_t live_nodes() const { return root_const()->num_live; }
+
+  bool is_root() const { return !parent; }
+
+  /// Verschmilzt die Arena `other` mit dieser Arena (siehe Klassenkommentar).
+  void merge(ArenaAllocator &other) {
+    ArenaAllocator *self = root();
+    ArenaAllocator *donor = other.root();
+    if (self == donor)
+      return;
+
+    for (auto &chunk : donor->chunks)
+      self->chunks.push_back(std::move(chunk));
+    for (auto &chunk : donor->spare_chunks)
+      self->spare_chunks.push_back(std::move(chunk));
+    donor->chunks.clear();
+    donor->spare_chunks.clear();
+    self->num_live += donor->num_live;
+    donor->num_live = 0;
+
+    if (donor->free_list) {
+      donor->free_tail->next_free = self->free_list;
+      if (!self->free_list)
+        self->free_tail = donor->free_tail;
+      self->free_list = donor->free_list;
+    }
+
+    // Der noch unbenutzte Rest des aktuellen Donor-Chunks wird verworfen.
+    donor->free_list = donor->free_tail = nullptr;
+    donor->bump = donor->bump_end = nullptr;
+    donor->parent = self->shared_from_this();
+  }
+
+  /// Anzahl der Bytes, die die Arena aktuell vom System belegt.
+  size_t reserved_bytes() const {
+    const ArenaAllocator *r = root_const();
+    return (r->chunks.size() + r->spare_chunks.size()) * NodesPerChunk *
+           sizeof(Slot);
+  }
+
+private:
+  union Slot {
+    Slot *next_free;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+  // `chunks` enthaelt alle Chunks, aus denen bereits Knoten vergeben wurden;
+  // `spare_chunks` sind nach einem `reset()` komplett frei.
+  std::vector<std::unique_ptr<Slot[]>> chunks;
+  std::vector<std::unique_ptr<Slot[]>> spare_chunks;
+  Slot *bump{nullptr};
+  Slot *bump_end{nullptr};
+  Slot *free_list{nullptr};
+  Slot *free_tail{nullptr};
+  size_t num_live{0};
+  std::shared_ptr<ArenaAllocator> parent;
+
+  ArenaAllocator *root() {
+    if (!parent)
+      return this;
+    // Pfadkompression wie bei Union-Find
+    while (parent->parent)
+      parent = parent->parent;
+    return parent.get();
+  }
+
+  const ArenaAllocator *root_const() const {
+    const ArenaAllocator *node = this;
+    while (node->parent)
+      node = node->parent.get();
+    return node;
+  }
+
+  void next_chunk() {
+    if (spare_chunks.empty()) {
+      chunks.emplace_back(new Slot[NodesPerChunk]);
+    } else {
+      chunks.push_back(std::move(spare_chunks.back()));
+      spare_chunks.pop_back();
+    }
+    bump = chunks.back().get();
+    bump_end = bump + NodesPerChunk;
+  }
+};
+
+#endif // ALLOCATOR_HPP
@@ -1,9 +1,11 @@
 #!/usr/bin/env bash
 set -e
 CXX=g++
-CXX_FLAGS="-std=c++17 -Wall -Wextra -Werror -pedantic"
+CXX_FLAGS="-std=c++17 -Wall -Wextra -Werror -pedantic -pthread"
 
 set -x
 $CXX $CXX_FLAGS -g -O0 -o tests tests.cpp
 $CXX $CXX_FLAGS    -O3 -o sort sort.cpp
+$CXX $CXX_FLAGS    -O3 -DALLOC_TRACKING_REPLACE_NEW -o sort_memory sort.cpp
+$CXX $CXX_FLAGS    -O3 -o microbench microbench.cpp
 
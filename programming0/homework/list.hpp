@@ -1,33 +1,262 @@
 #ifndef LIST_HPP
 #define LIST_HPP
 
+#include "allocator.hpp"
+#include "pivot.hpp"
+#include "sort_stats.hpp"
+#include "sorting_network.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
-class List {
+template <typename V> struct ListItem;
+
+/// Partitionierungsmodus von `BasicList::sort`.
+enum class Partitioning {
+  /// `< pivot` und `>= pivot`
+  TwoWay,
+  /// `< pivot`, `== pivot` und `> pivot`; nur die aeusseren Teile werden
+  /// weiter sortiert.
+  ThreeWay,
+};
+
+/// Standardwert fuer `NetworkCutoff` von `BasicList::sort`: Segmente mit
+/// hoechstens so vielen Elementen werden per Sortiernetzwerk sortiert.
+inline constexpr size_t default_network_cutoff = 16;
+
+namespace list_detail {
+
+/// Laedt die Cache-Line von `ptr` im Voraus. Ein Prefetch loest nie einen
+/// Speicherzugriffsfehler aus; `ptr` darf also auch veraltet sein.
+inline void prefetch(const void *ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(ptr);
+#else
+  (void)ptr;
+#endif
+}
+
+} // namespace list_detail
+
+/// Knotenadressen eines Durchlaufs in Durchlaufreihenfolge, als Hinweise fuer
+/// die Prefetch-Varianten von `BasicList::foreach`, `is_sorted` und
+/// `move_into_if`. Ein solcher Durchlauf laedt die Knoten `distance`
+/// Positionen im Voraus anhand der Hinweise des vorherigen Durchlaufs und
+/// hinterlegt dabei die aktuellen Adressen fuer den naechsten. Die Hinweise
+/// werden nur fuer den Prefetch verwendet und nie dereferenziert; nach
+/// Aenderungen der Liste sind sie lediglich weniger treffsicher.
+///
+/// Die Hinweise gehoeren dem Aufrufer und kosten einen Zeiger pro Element.
+/// Die Liste selbst bleibt unveraendert; konstante Durchlaeufe derselben
+/// Liste duerfen also gleichzeitig laufen, solange jeder Thread eigene
+/// Hinweise verwendet.
+///
+/// # Example
+/// ```c++
+/// PrefetchHints hints;
+/// lst.foreach(hints, [&](int val) { sum += val; }); // legt die Hinweise an
+/// lst.foreach(hints, [&](int val) { sum += val; }); // nutzt sie
+/// ```
+class PrefetchHints {
+public:
+  /// Abstand (in Elementen), in dem vorausgeladen wird.
+  static constexpr size_t distance = 16;
+
+  /// Stellt Platz fuer einen Durchlauf ueber `n` Knoten bereit.
+  void prepare(size_t n) {
+    if (nodes.size() < n) {
+      nodes.resize(n);
+    }
+  }
+
+  /// Laedt den Knoten `distance` Positionen nach `pos` voraus und merkt sich
+  /// `node` als Knoten an Position `pos`.
+  void visit(size_t pos, const void *node) {
+    if (pos + distance < nodes.size()) {
+      list_detail::prefetch(nodes[pos + distance]);
+    }
+    nodes[pos] = node;
+  }
+
+private:
+  std::vector<const void *> nodes;
+};
+
+/// Verkettungsteil eines Knotens. Der Dummy-Knoten der Liste besteht nur aus
+/// diesem Teil und benoetigt daher keinen Wert.
+template <typename V> struct ListLink {
+  ListItem<V> *next{nullptr};
+};
+
+template <typename V> struct ListItem : ListLink<V> {
+  ListItem(V v) : value{std::move(v)} {}
+
+  const V &get_value() const { return value; }
+
+  /// Erlaubt es, den Wert (z.B. eine move-only Nutzlast) aus einem
+  /// entfernten Item herauszuschieben.
+  V &get_value() { return value; }
+
+private:
+  V value;
+};
+
+/// Vorwaertsiterator ueber die Werte einer `BasicList`. Er zeigt auf einen
+/// Knoten der Kette; der Dummy-Knoten (`before_begin`) darf nur als Position
+/// fuer `insert_after`/`erase_after` verwendet, aber nicht dereferenziert
+/// werden. `end()` entspricht dem Nullzeiger.
+template <typename V, bool Const> class ListIterator {
 public:
-  using Value = int;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = V;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::conditional_t<Const, const V &, V &>;
+  using pointer = std::conditional_t<Const, const V *, V *>;
 
-  struct Item {
-    std::unique_ptr<Item> next;
+  ListIterator() = default;
 
-    Item() : Item(0) {}
+  explicit ListIterator(ListLink<V> *node) : node{node} {}
 
-    Item(Value v) : value{v} {}
+  /// Ein veraenderlicher Iterator laesst sich in einen konstanten umwandeln.
+  template <bool C = Const, typename = std::enable_if_t<C>>
+  ListIterator(const ListIterator<V, false> &other) : node{other.node} {}
 
-    const Value &get_value() { return value; }
+  reference operator*() const {
+    return static_cast<ListItem<V> *>(node)->get_value();
+  }
+
+  pointer operator->() const { return &**this; }
+
+  ListIterator &operator++() {
+    node = node->next;
+    return *this;
+  }
+
+  ListIterator operator++(int) {
+    ListIterator old = *this;
+    ++*this;
+    return old;
+  }
+
+  friend bool operator==(const ListIterator &a, const ListIterator &b) {
+    return a.node == b.node;
+  }
+
+  friend bool operator!=(const ListIterator &a, const ListIterator &b) {
+    return a.node != b.node;
+  }
+
+private:
+  template <typename, bool> friend class ListIterator;
+  template <typename, typename, typename> friend class BasicList;
+
+  ListLink<V> *node{nullptr};
+};
+
+/// Einfach verkettete Liste mit Werten vom Typ `T`, die mittels `Compare`
+/// (standardmaessig `std::less<T>`) sortiert wird. Beim Sortieren werden nur
+/// Knoten umgehaengt, Werte werden nie kopiert oder verschoben (ausser mit
+/// `compact_after_sort`); `T` darf daher auch move-only sein. Ein
+/// zustandsloser Vergleicher wird vom Compiler inline eingesetzt.
+///
+/// Die Knoten werden ueber die Allokator-Policy `Allocator` angelegt (siehe
+/// allocator.hpp); standardmaessig stammen sie aus einer Arena, die sich alle
+/// Listen teilen, zwischen denen Knoten verschoben werden.
+template <typename T = int, typename Compare = std::less<T>,
+          typename Allocator = ArenaAllocator<ListItem<T>>>
+class BasicList {
+public:
+  using Value = T;
+  using Item = ListItem<Value>;
+  using Link = ListLink<Value>;
+  using iterator = ListIterator<Value, false>;
+  using const_iterator = ListIterator<Value, true>;
+
+  /// Gibt ein Item an den Allokator der Liste zurueck, aus der es stammt.
+  struct ItemDeleter {
+    Allocator *allocator{nullptr};
 
-  private:
-    Value value;
+    void operator()(Item *item) const {
+      item->~Item();
+      allocator->deallocate(item);
+    }
   };
 
+  /// Besitzender Zeiger auf ein einzelnes, aus der Liste entferntes Item.
+  /// Er darf die Liste, aus der er stammt, nicht ueberleben.
+  using ItemPtr = std::unique_ptr<Item, ItemDeleter>;
+
   /// Erzeugt eine leere Liste
-  List() {last = &dummy;}
+  BasicList() : BasicList(std::make_shared<Allocator>()) {}
+
+  /// Erzeugt eine leere Liste, die ihre Knoten aus `allocator` bezieht und
+  /// mit `compare` vergleicht.
+  explicit BasicList(std::shared_ptr<Allocator> allocator,
+                     Compare compare = Compare{})
+      : allocator{std::move(allocator)}, compare{std::move(compare)} {
+    last = &dummy;
+  }
+
+  /// Erzeugt eine Liste mit den Werten aus `[first, past_last)` (siehe
+  /// `append_range`).
+  ///
+  /// # Example
+  /// ```c++
+  /// std::vector<int> values{3, 1, 2};
+  /// List lst(values.begin(), values.end());
+  /// ```
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  BasicList(InputIt first, InputIt past_last,
+            std::shared_ptr<Allocator> allocator = std::make_shared<Allocator>(),
+            Compare compare = Compare{})
+      : BasicList(std::move(allocator), std::move(compare)) {
+    append_range(first, past_last);
+  }
+
+  /// Erzeugt eine Liste mit den angegebenen Werten.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst{3, 1, 2};
+  /// std::cout << lst << "\n"; // gibt "[3, 1, 2]" aus.
+  /// ```
+  BasicList(std::initializer_list<Value> values,
+            std::shared_ptr<Allocator> allocator = std::make_shared<Allocator>(),
+            Compare compare = Compare{})
+      : BasicList(values.begin(), values.end(), std::move(allocator),
+                  std::move(compare)) {}
 
   /// Wir loeschen den Copy-Konstruktor. Damit ist es nicht mehr
   /// moeglich aus versehen eine teure Kopie der Liste zu erstellen.
-  List(List &) = delete;
+  BasicList(BasicList &) = delete;
+
+  /// Uebernimmt alle Knoten von `other` in O(1). `other` ist danach leer,
+  /// teilt sich aber weiterhin den Allokator und bleibt benutzbar. Damit
+  /// lassen sich Listen z.B. in einem `std::vector` halten.
+  BasicList(BasicList &&other) noexcept(
+      std::is_nothrow_copy_constructible_v<Compare>)
+      : num_items{other.num_items}, allocator{other.allocator},
+        compare{other.compare},
+        auto_compact_min_size{other.auto_compact_min_size} {
+    dummy.next = other.dummy.next;
+    last = other.empty() ? &dummy : other.last;
+    other.dummy.next = nullptr;
+    other.last = &other.dummy;
+    other.num_items = 0;
+  }
 
   /// AUFGABE 1: Destruktor für List:
   ///
@@ -36,11 +265,40 @@ public:
   /// Dieser Destruktor soll solange in einer Schleife pop_front() aufrufen,
   /// bis die Liste leer ist. Nutzen Sie dabei aus, dass –wie oben beschrieben– pop_front() einen UP zurück
   /// liefert, der automatisch gelöscht wir
-  ~List() {
-    while( !empty()) {
+  ~BasicList() { clear(); }
+
+  /// Entfernt alle Elemente der Liste. Gehoert die Arena allein dieser Liste
+  /// und haelt niemand mehr ein `ItemPtr` daraus, wird sie in O(1)
+  /// zurueckgesetzt; andernfalls werden die Knoten einzeln an den Allokator
+  /// zurueckgegeben.
+  void clear() {
+    if constexpr (Allocator::supports_reset &&
+                  std::is_trivially_destructible_v<Value>) {
+      if (allocator.use_count() == 1 && allocator->is_root() &&
+          allocator->live_nodes() == num_items) {
+        allocator->reset();
+        dummy.next = nullptr;
+        last = &dummy;
+        num_items = 0;
+        return;
+      }
+    }
+    while (!empty()) {
       pop_front();
     }
-    // std::cout << "Destruktor ausgeführt: Speicher freigegeben." << std::endl;
+  }
+
+  /// Gibt den Allokator zurueck, aus dem die Liste ihre Knoten bezieht.
+  const std::shared_ptr<Allocator> &get_allocator() const { return allocator; }
+
+  /// Gibt den Vergleicher zurueck, nach dem die Liste sortiert.
+  const Compare &get_compare() const { return compare; }
+
+  /// Erzeugt ein neues, noch nicht eingefuegtes Item aus dem Allokator der
+  /// Liste, z.B. fuer `push_back_item`.
+  ItemPtr make_item(Value val) {
+    return ItemPtr(new (allocator->allocate()) Item(std::move(val)),
+                   ItemDeleter{allocator.get()});
   }
 
   /// Gibt genau dann `true` zurueck, wenn die Liste leer ist.
@@ -76,15 +334,15 @@ public:
   /// std::cout << lst << "\n"; // gibt "[2, 1]" aus.
   /// ```
   Item *push_front(Value val) {
-    auto new_item = std::make_unique<Item>(val);
-    new_item->next = std::move(dummy.next);
-    dummy.next = std::move(new_item);
+    Item *new_item = new (allocator->allocate()) Item(std::move(val));
+    new_item->next = dummy.next;
+    dummy.next = new_item;
 
     // update des letzten Elements, falls die Liste leer ist.
-    if (num_items == 0) {last = dummy.next.get();}
+    if (num_items == 0) {last = dummy.next;}
 
     ++num_items;
-    return dummy.next.get();
+    return dummy.next;
   }
 
   /// Entfernt das erste Element der Liste und gibt das Item als unique_ptr
@@ -104,7 +362,7 @@ public:
   ///    assert(!item); // item ist "non-owning" nullptr, da die Liste leer ist.
   /// }
   /// ```
-  std::unique_ptr<Item> pop_front() { return extract_after(dummy); }
+  ItemPtr pop_front() { return extract_after(dummy); }
 
   /// Hilfsfunktion, die eine Callback-Funktion fuer jedes Element in der Liste
   /// aufruft. Das Callback sollte eine Funktion sein, die ein const Value& als
@@ -119,13 +377,105 @@ public:
   /// gibt "2 1 " aus.
   /// ```
   template <typename Callback> void foreach (Callback &&cb) const {
-    Item *current = dummy.next.get();
+    const Item *current = dummy.next;
     while (current != nullptr) {
       cb(current->get_value());
-      current = current->next.get();
+      current = current->next;
     }
   }
 
+  /// Wie `foreach`, laedt die Knoten aber anhand von `hints` im Voraus (siehe
+  /// `PrefetchHints`). So sind mehrere Speicherzugriffe gleichzeitig
+  /// unterwegs, statt dass jeder Cache-Miss erst beim Folgen des
+  /// `next`-Zeigers auffaellt. Das lohnt sich bei wiederholten Durchlaeufen
+  /// grosser, im Speicher verstreuter Listen.
+  ///
+  /// ```c++
+  /// PrefetchHints hints;
+  /// lst.foreach(hints, [&](int val) { sum += val; });
+  /// ```
+  template <typename Callback>
+  void foreach (PrefetchHints &hints, Callback &&cb) const {
+    const Item *current = dummy.next;
+    hints.prepare(size());
+    for (size_t pos = 0; current != nullptr; ++pos) {
+      hints.visit(pos, current);
+      cb(current->get_value());
+      current = current->next;
+    }
+  }
+
+  /// Vorwaertsiteratoren ueber die Werte der Liste, z.B. fuer range-based
+  /// `for` und die Algorithmen der Standardbibliothek. Iteratoren bleiben
+  /// gueltig, solange ihr Knoten nicht entfernt wird; `sort` haengt Knoten
+  /// nur um, aendert also die Reihenfolge, aber nicht die Gueltigkeit.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst;
+  /// lst.push_back(1);
+  /// lst.push_back(2);
+  /// for (int &val : lst) val *= 10;
+  /// std::cout << std::accumulate(lst.begin(), lst.end(), 0); // gibt "30" aus.
+  /// ```
+  iterator begin() { return iterator(dummy.next); }
+  iterator end() { return iterator(); }
+  const_iterator begin() const { return cbegin(); }
+  const_iterator end() const { return cend(); }
+  const_iterator cbegin() const { return const_iterator(dummy.next); }
+  const_iterator cend() const { return const_iterator(); }
+
+  /// Position vor dem ersten Element (der Dummy-Knoten), z.B. um mit
+  /// `insert_after` vorn einzufuegen. Darf nicht dereferenziert werden.
+  iterator before_begin() { return iterator(&dummy); }
+  const_iterator before_begin() const { return cbefore_begin(); }
+  const_iterator cbefore_begin() const {
+    return const_iterator(const_cast<Link *>(&dummy));
+  }
+
+  /// Fuegt ein Element mit Wert `val` hinter `pos` ein und gibt einen
+  /// Iterator darauf zurueck. `pos` darf `before_begin()` sein, aber nicht
+  /// `end()`.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst;
+  /// lst.push_back(1);
+  /// lst.push_back(3);
+  /// lst.insert_after(lst.begin(), 2);
+  /// std::cout << lst << "\n"; // gibt "[1, 2, 3]" aus.
+  /// ```
+  iterator insert_after(const_iterator pos, Value val) {
+    Link *before = pos.node;
+    assert(before);
+    Item *new_item = new (allocator->allocate()) Item(std::move(val));
+    new_item->next = before->next;
+    before->next = new_item;
+    if (last == before) {
+      last = new_item;
+    }
+    ++num_items;
+    return iterator(new_item);
+  }
+
+  /// Entfernt das Element hinter `pos` und gibt einen Iterator auf seinen
+  /// Nachfolger zurueck. Hinter `pos` muss ein Element stehen.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst;
+  /// lst.push_back(1);
+  /// lst.push_back(2);
+  /// lst.erase_after(lst.before_begin());
+  /// std::cout << lst << "\n"; // gibt "[2]" aus.
+  /// ```
+  iterator erase_after(const_iterator pos) {
+    assert(pos.node && pos.node->next);
+    Link &before = *pos.node;
+    extract_after(before);
+    return iterator(before.next);
+  }
+
   /// Diese Funktion erlaubt es eine Liste direkt auf einem ostream auszugeben,
   /// z.B. mittels std::cout.
   ///
@@ -137,7 +487,7 @@ public:
   /// std::cout << lst << "\n";
   /// ```
   /// Erzeugt die Ausgabe `[1, 2]`
-  friend std::ostream &operator<<(std::ostream &stream, const List &list) {
+  friend std::ostream &operator<<(std::ostream &stream, const BasicList &list) {
     stream << '[';
     bool first_element = true;
     list.foreach ([&](const Value &value) {
@@ -162,31 +512,92 @@ public:
   /// std::cout << lst << "\n"; // gibt "[1, 2]" aus.
   /// ```
   Item *push_back(Value val) { //
-    return push_back_item(std::make_unique<Item>(val));
+    Item *new_item = new (allocator->allocate()) Item(std::move(val));
+    last->next = new_item;
+    last = new_item;
+    num_items++;
+    return new_item;
+  }
+
+  /// Haengt die Werte aus `[first, past_last)` hinten an die Liste an. Ist
+  /// die Laenge vorab bekannt (Forward-Iteratoren), werden alle Knoten mit
+  /// einem einzigen `allocate_bulk` angelegt und in einem Durchlauf
+  /// verkettet; bei einer Arena liegen sie dann auch im Speicher
+  /// hintereinander.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst{1};
+  /// std::vector<int> values{2, 3};
+  /// lst.append_range(values.begin(), values.end());
+  /// std::cout << lst << "\n"; // gibt "[1, 2, 3]" aus.
+  /// ```
+  template <typename InputIt>
+  void append_range(InputIt first, InputIt past_last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      const auto n = static_cast<size_t>(std::distance(first, past_last));
+      allocator->allocate_bulk(n, [&](void *ptr) {
+        Item *new_item = new (ptr) Item(*first);
+        last->next = new_item;
+        last = new_item;
+        ++num_items;
+        ++first;
+      });
+    } else {
+      for (; first != past_last; ++first) {
+        push_back(*first);
+      }
+    }
+  }
+
+  /// Haengt alle Werte eines Containers (z.B. `std::vector`, `std::array`
+  /// oder eines C-Arrays) hinten an die Liste an.
+  template <typename Range>
+  auto append_range(const Range &range)
+      -> decltype(std::begin(range), std::end(range), void()) {
+    append_range(std::begin(range), std::end(range));
   }
 
-  /// Empfaengt ein (owned) unique_ptr<Item> und haengt das Item hinten an die
+  /// Verschiebt alle Werte der Reihe nach an das Ende von `out` und leert
+  /// die Liste. Der Platz in `out` wird vorab in einem Stueck reserviert.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst{1, 2};
+  /// std::vector<int> values;
+  /// lst.drain_to(values);
+  /// assert(lst.empty() && values.size() == 2);
+  /// ```
+  void drain_to(std::vector<Value> &out) {
+    out.reserve(out.size() + size());
+    for (Item *current = dummy.next; current; current = current->next) {
+      out.push_back(std::move(current->get_value()));
+    }
+    clear();
+  }
+
+  /// Empfaengt ein (owned) ItemPtr und haengt das Item hinten an die
   /// Liste an.
   ///
   /// # Example
   /// ```c++
   /// List lst;
-  /// lst.push_back_item(std::make_unique<List::Item>(1));
+  /// lst.push_back_item(lst.make_item(1));
   /// std::cout << lst << "\n"; // gibt "[1]" aus.
   /// ```
-  Item *push_back_item(std::unique_ptr<Item> &&item) {
+  Item *push_back_item(ItemPtr &&item) {
     assert(!!item); // Tipp: `!!item` ist ein short-cut für
                     // `static_cast<bool>(item)`
-    if (num_items == 0) {
-      dummy.next = std::move(item);
-      last = dummy.next.get();
-    } else {
-      last->next = std::move(item);  
-      last = last->next.get();
+    if (item.get_deleter().allocator != allocator.get()) {
+      allocator->merge(*item.get_deleter().allocator);
     }
+    Item *appended = item.release();
+    last->next = appended;
+    last = appended;
     num_items++;
     assert(!last->next);
-    return nullptr;
+    return appended;
   }
 
   /// Iteriert durch die Liste und ruft `predicate` fuer jedes Element auf.
@@ -204,28 +615,58 @@ public:
   /// std::cout << lst_even << std::endl; // gibt "[0, 2, 4, 6, 8]" aus.
   /// ```
   template <typename Predicate>
-  void move_into_if(List &append_to_if_true, Predicate &&predicate) {
-    const size_t initial_size = size() + append_to_if_true.size();
-    (void)initial_size; // verhindert eine Warnung, falls assert wegoptimiert
-    // wurde
-    assert(!this->empty());
+  void move_into_if(BasicList &append_to_if_true, Predicate &&predicate) {
+    move_into_if_impl<false>(nullptr, append_to_if_true, predicate);
+  }
 
-    Item* before = &dummy;
-    Item* current = dummy.next.get();
+  /// Wie `move_into_if`, laedt die Knoten aber anhand von `hints` im Voraus
+  /// (siehe `PrefetchHints`).
+  template <typename Predicate>
+  void move_into_if(PrefetchHints &hints, BasicList &append_to_if_true,
+                    Predicate &&predicate) {
+    move_into_if_impl<true>(&hints, append_to_if_true, predicate);
+  }
 
-    while (current) {
-      if (predicate(current->get_value())) { 
-        auto extracted_item = extract_after(*before);
-        append_to_if_true.push_back_item(std::move(extracted_item));
-        current = before->next.get();
-      } else {
-      before = current;
-      current = current->next.get();
+  /// Verteilt alle Elemente in einem Durchlauf auf die Listen in `buckets`
+  /// (z.B. `std::vector<List>` oder `std::array<List, k>`): Jeder Knoten wird
+  /// an das Ende der Liste `buckets[classify(val)]` umgehaengt. Die
+  /// Reihenfolge innerhalb eines Buckets bleibt erhalten, vorhandene Elemente
+  /// der Buckets bleiben vorne. Diese Liste ist danach leer. Fuer viele
+  /// Buckets mit Bereichsgrenzen eignet sich `SplitterTree` (siehe
+  /// splitter_tree.hpp) als `classify`.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst{5, 1, 4, 2, 3};
+  /// std::vector<List> buckets(3);
+  /// lst.move_into_buckets(buckets, [](int val) { return val % 3; });
+  /// std::cout << buckets[1] << std::endl; // gibt "[1, 4]" aus.
+  /// ```
+  template <typename Buckets, typename Classifier>
+  void move_into_buckets(Buckets &buckets, Classifier &&classify) {
+    for (BasicList &bucket : buckets) {
+      assert(&bucket != this);
+      if (bucket.allocator != allocator) {
+        bucket.allocator->merge(*allocator);
       }
-      // std::cout << append_to_if_true <<std::endl;
     }
 
-    assert(size() + append_to_if_true.size() == initial_size);
+    // Die `next`-Zeiger der Bucket-Enden werden erst am Schluss abgeschlossen.
+    for (Item *current = dummy.next; current; current = current->next) {
+      const size_t idx = classify(std::as_const(*current).get_value());
+      assert(idx < std::size(buckets));
+      BasicList &bucket = buckets[idx];
+      bucket.last->next = current;
+      bucket.last = current;
+      ++bucket.num_items;
+    }
+    for (BasicList &bucket : buckets) {
+      bucket.last->next = nullptr;
+    }
+
+    dummy.next = nullptr;
+    last = &dummy;
+    num_items = 0;
   }
 
   /// Hängt die übergebene Liste an die aktuelle Liste an; die übergebene Liste
@@ -242,26 +683,266 @@ public:
   /// std::cout << lst2 << std::endl; // gibt "[]" aus.
   /// ```
   // corrected concat
-  void concat(List &other) {
-    // (void)other; // verhindert Warnung; kann entfernt werden, sobald die
-    // auskommentierte Implementierung genutzt wird.
-    
+  void concat(BasicList &other) {
+    if (other.empty()) {return;}
+
+    if (other.allocator != allocator) {
+      allocator->merge(*other.allocator);
+    }
+
     // Change in Aufgabe 3: Updating the last value of the new concated list
-    auto last_2 = std::move(other.last);
+    auto last_2 = other.last;
 
-    last->next = std::move(other.dummy.next); 
+    last->next = other.dummy.next; 
     num_items += other.num_items;
+    other.dummy.next = nullptr;
     other.num_items = 0;
     other.last = &other.dummy;
 
     // Change in Aufgabe 3: Updating the last value of the new concated list
-    last = std::move(last_2);   
+    last = last_2;   
+  }
+
+
+  /// Verschmilzt die sortierte Liste `other` stabil mit dieser sortierten
+  /// Liste; `other` ist danach leer. Die Knoten werden nur umgehaengt (O(n +
+  /// m), keine Allokation); bei gleichen Werten stehen die Elemente dieser
+  /// Liste vor denen aus `other`.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst1{1, 3, 5};
+  /// List lst2{2, 3, 4};
+  /// lst1.merge(lst2);
+  /// std::cout << lst1 << std::endl; // gibt "[1, 2, 3, 3, 4, 5]" aus.
+  /// ```
+  void merge(BasicList &other) {
+    assert(&other != this);
+    assert(is_sorted() && other.is_sorted());
+    if (other.empty()) {
+      return;
+    }
+    if (other.allocator != allocator) {
+      allocator->merge(*other.allocator);
+    }
+
+    NoSortStats stats;
+    last = merge_chains(dummy.next, other.dummy.next, &dummy, stats);
+    num_items += other.num_items;
+    other.dummy.next = nullptr;
+    other.num_items = 0;
+    other.last = &other.dummy;
+  }
+
+  /// Verschmilzt diese und alle Listen in `others` (alle sortiert) stabil zu
+  /// einer sortierten Liste; die Listen in `others` sind danach leer. Ein
+  /// Verlierer-Baum (Tournament) ueber die k nicht-leeren Eingaben bestimmt
+  /// mit ceil(log2 k) Vergleichen das naechste Element, das dann nur
+  /// umgehaengt wird; insgesamt also O(N log k) Vergleiche und keine
+  /// Allokation fuer die Knoten. Von jeder Eingabe wird der uebernaechste
+  /// Knoten per Prefetch geladen, waehrend die anderen Eingaben an der Reihe
+  /// sind. Bei gleichen Werten kommen die Elemente dieser Liste zuerst, dann
+  /// die aus `others` in deren Reihenfolge.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst{1, 4};
+  /// std::vector<List> runs;
+  /// runs.push_back(List{2, 5});
+  /// runs.push_back(List{0, 3});
+  /// lst.merge_k(runs);
+  /// std::cout << lst << std::endl; // gibt "[0, 1, 2, 3, 4, 5]" aus.
+  /// ```
+  void merge_k(std::vector<BasicList> &others) {
+    assert(is_sorted());
+    // Koepfe der nicht-leeren Eingaben, in stabiler Reihenfolge
+    std::vector<Item *> heads;
+    heads.reserve(others.size() + 1);
+    if (!empty()) {
+      heads.push_back(dummy.next);
+    }
+    // Ende der zuletzt uebernommenen Eingabe; gibt es nur eine, ist es das
+    // Ende des Ergebnisses.
+    Link *input_last = last;
+    for (BasicList &other : others) {
+      assert(&other != this && other.is_sorted());
+      if (other.empty()) {
+        continue;
+      }
+      if (other.allocator != allocator) {
+        allocator->merge(*other.allocator);
+      }
+      heads.push_back(other.dummy.next);
+      input_last = other.last;
+      num_items += other.num_items;
+      other.dummy.next = nullptr;
+      other.num_items = 0;
+      other.last = &other.dummy;
+    }
+    if (heads.size() < 2) {
+      dummy.next = heads.empty() ? nullptr : heads[0];
+      last = heads.empty() ? &dummy : input_last;
+      return;
+    }
+
+    // Eingabe a gewinnt gegen b, wenn ihr Kopf kleiner ist, bei Gleichheit
+    // die mit kleinerem Index. Erschoepfte Eingaben verlieren immer.
+    // `x` und `y` sind die Koepfe der Eingaben a und b.
+    auto beats = [&](size_t a, const Item *x, size_t b, const Item *y) {
+      if (!x || !y) {
+        return x != nullptr;
+      }
+      return a < b ? !less(y->get_value(), x->get_value())
+                   : less(x->get_value(), y->get_value());
+    };
+
+    // Knoten 1, ..., k-1 des impliziten Baums speichern den Verlierer ihres
+    // Spiels; Eingabe i ist das Blatt k + i.
+    const size_t k = heads.size();
+    std::vector<size_t> losers(k);
+    {
+      std::vector<size_t> winners(2 * k);
+      for (size_t i = 0; i < k; ++i) {
+        winners[k + i] = i;
+      }
+      for (size_t node = k - 1; node > 0; --node) {
+        const size_t left = winners[2 * node];
+        const size_t right = winners[2 * node + 1];
+        const bool left_wins = beats(left, heads[left], right, heads[right]);
+        winners[node] = left_wins ? left : right;
+        losers[node] = left_wins ? right : left;
+      }
+      losers[0] = winners[1];
+    }
+
+    // Der Sieger wird nur gegen die Verlierer auf seinem Pfad zur Wurzel
+    // neu ausgespielt; sein Kopf bleibt dabei in einem Register.
+    Link *tail = &dummy;
+    size_t winner = losers[0];
+    for (Item *item = heads[winner]; item;) {
+      tail->next = item;
+      tail = item;
+      item = item->next;
+      heads[winner] = item;
+      if (item) {
+        list_detail::prefetch(item->next);
+      }
+      for (size_t node = (k + winner) / 2; node > 0; node /= 2) {
+        const size_t challenger = losers[node];
+        Item *other = heads[challenger];
+        const bool challenger_wins = beats(challenger, other, winner, item);
+        // Als bedingte Zuweisungen, da der Ausgang kaum vorhersagbar ist
+        losers[node] = challenger_wins ? winner : challenger;
+        winner = challenger_wins ? challenger : winner;
+        item = challenger_wins ? other : item;
+      }
+    }
+    tail->next = nullptr;
+    last = tail;
+  }
+
+  /// Vereinigung zweier sortierter Listen (wie `std::set_union`): Elemente
+  /// aus `other`, zu denen es in dieser Liste kein gleiches Gegenstueck
+  /// gibt, werden an ihrer Position eingehaengt, die uebrigen freigegeben.
+  /// Kommt ein Wert k-mal hier und l-mal in `other` vor, so steht er danach
+  /// max(k, l)-mal in der Liste. `other` ist danach leer; Werte werden nie
+  /// kopiert. Laufzeit O(n + m).
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst1{1, 3, 5};
+  /// List lst2{2, 3, 4};
+  /// lst1.set_union(lst2);
+  /// std::cout << lst1 << std::endl; // gibt "[1, 2, 3, 4, 5]" aus.
+  /// ```
+  void set_union(BasicList &other) {
+    assert(&other != this);
+    assert(is_sorted() && other.is_sorted());
+    if (other.empty()) {
+      return;
+    }
+    if (other.allocator != allocator) {
+      allocator->merge(*other.allocator);
+    }
+
+    Link *tail = &dummy;
+    Item *left = dummy.next;
+    Item *right = other.dummy.next;
+    Link *right_last = other.last;
+    num_items += other.num_items;
+    other.dummy.next = nullptr;
+    other.num_items = 0;
+    other.last = &other.dummy;
+
+    while (left && right) {
+      if (less(right->get_value(), left->get_value())) {
+        tail->next = right;
+        right = right->next;
+      } else {
+        if (!less(left->get_value(), right->get_value())) {
+          Item *duplicate = right;
+          right = right->next;
+          destroy_item(duplicate);
+          --num_items;
+        }
+        tail->next = left;
+        left = left->next;
+      }
+      tail = tail->next;
+    }
+    if (left) {
+      tail->next = left;
+    } else {
+      tail->next = right;
+      last = right ? right_last : tail;
+    }
+  }
+
+  /// Schnitt zweier sortierter Listen (wie `std::set_intersection`): Es
+  /// bleiben nur die Elemente dieser Liste, zu denen es in `other` ein
+  /// gleiches Gegenstueck gibt (bei k bzw. l Vorkommen also min(k, l)); die
+  /// uebrigen werden freigegeben. `other` bleibt unveraendert. Laufzeit
+  /// O(n + m).
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst1{1, 3, 5};
+  /// List lst2{2, 3, 4, 5};
+  /// lst1.set_intersection(lst2);
+  /// std::cout << lst1 << std::endl; // gibt "[3, 5]" aus.
+  /// ```
+  void set_intersection(const BasicList &other) {
+    assert(is_sorted() && other.is_sorted());
+    if (&other == this) {
+      return;
+    }
+    filter_sorted(other, true);
   }
 
+  /// Differenz zweier sortierter Listen (wie `std::set_difference`): Jedes
+  /// Element aus `other` entfernt (und gibt frei) hoechstens ein gleiches
+  /// Element dieser Liste. `other` bleibt unveraendert. Laufzeit O(n + m).
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst1{1, 3, 3, 5};
+  /// List lst2{3, 4, 5};
+  /// lst1.set_difference(lst2);
+  /// std::cout << lst1 << std::endl; // gibt "[1, 3]" aus.
+  /// ```
+  void set_difference(const BasicList &other) {
+    assert(is_sorted() && other.is_sorted());
+    if (&other == this) {
+      clear();
+      return;
+    }
+    filter_sorted(other, false);
+  }
   
   //Ergänzung, um den Test für Aufg. 3 durchführen zu können
+  //(gibt nullptr zurueck, falls die Liste leer ist)
   Item* get_last() const {
-    return last;
+    return empty() ? nullptr : static_cast<Item *>(last);
   }
 
   /// Gibt genau dann `true` zurueck, wenn die Liste sortiert ist.
@@ -276,23 +957,28 @@ public:
   /// lst.push_back(1);
   /// assert(!lst.is_sorted());
   /// ```
-  bool is_sorted() const {
-    if (empty())
-      return true;
+  bool is_sorted() const { return is_sorted_impl<false>(nullptr); }
 
-    Item *current = dummy.next.get();
-    while (current->next) {
-      if (current->get_value() > current->next->get_value()) {
-        return false;
-      }
-      current = current->next.get();
-    }
-    return true;
+  /// Wie `is_sorted`, laedt die Knoten aber anhand von `hints` im Voraus
+  /// (siehe `PrefetchHints`).
+  bool is_sorted(PrefetchHints &hints) const {
+    return is_sorted_impl<true>(&hints);
   }
 
   /// Sortiert die Liste mittels QuickSort-Algorithmus und gibt
-  /// die Anzahl der Vergleiche zurück. Als Pivotelement wird immer das erste
-  /// Element der Liste verwendet.
+  /// die Anzahl der Vergleiche zurück. Das Pivotelement wird durch die
+  /// `PivotPolicy` bestimmt (siehe pivot.hpp); standardmaessig wird immer das
+  /// erste Element der Liste verwendet. Mit `Partitioning::ThreeWay` werden
+  /// die zum Pivot gleichen Elemente in einem eigenen Segment gesammelt und
+  /// nicht weiter sortiert, was bei vielen Duplikaten viel Arbeit spart.
+  ///
+  /// Segmente mit hoechstens `NetworkCutoff` (maximal 64) Elementen werden
+  /// nicht weiter partitioniert: Ihre Knotenzeiger werden in einen Puffer auf
+  /// dem Stack gesammelt, mit einem zur Compile-Zeit erzeugten
+  /// Sortiernetzwerk (siehe sorting_network.hpp) nach ihren Werten sortiert
+  /// und in dieser Reihenfolge wieder verkettet. Die Werte bleiben dabei in
+  /// ihren Knoten. Mit `NetworkCutoff` 0 oder 1 wird bis auf einzelne
+  /// Elemente partitioniert.
   ///
   /// # Example
   /// ```c++
@@ -303,60 +989,754 @@ public:
   /// lst.push_back(4);
   /// lst.sort();
   /// std::cout << lst << std::endl; // gibt "[1, 2, 3, 4]" aus.
+  /// lst.sort<PivotMedianOfThree>();
+  /// lst.sort<PivotMedianOfThree, Partitioning::ThreeWay>();
+  /// lst.sort<PivotMedianOfThree, Partitioning::TwoWay, 32>();
   /// ```
-  uint64_t sort(uint16_t num_of_comparisons = 0) {
+  template <typename PivotPolicy = PivotFirst,
+            Partitioning P = Partitioning::TwoWay,
+            size_t NetworkCutoff = default_network_cutoff>
+  uint64_t sort(uint64_t num_of_comparisons = 0,
+                PivotPolicy pivot_policy = {}) {
+    return num_of_comparisons + sort_with<P, NetworkCutoff>(pivot_policy);
+  }
 
-    if (this->size() <=1 ) {return num_of_comparisons;}
+  /// Wie `sort`, verwendet aber die uebergebene Policy-Instanz (z.B. um den
+  /// Zustand eines Zufallsgenerators ueber mehrere Aufrufe zu behalten).
+  template <Partitioning P = Partitioning::TwoWay,
+            size_t NetworkCutoff = default_network_cutoff,
+            typename PivotPolicy>
+  uint64_t sort_with(PivotPolicy &pivot_policy) {
+    SortStats stats;
+    sort_with<P, NetworkCutoff>(pivot_policy, stats);
+    return stats.comparisons;
+  }
 
-    List greater_or_equal;
+  /// Wie `sort_with`, zeichnet aber Vergleiche, umgehaengte Knoten,
+  /// Rekursionstiefe und Balance der Partitionierungen in `stats` auf (siehe
+  /// sort_stats.hpp). Mit `NoSortStats` entfaellt jede Zaehlarbeit.
+  ///
+  /// Die Sortierung arbeitet iterativ auf Segmenten der Liste: Ein Segment
+  /// wird durch seinen Vorgaenger und seine Laenge beschrieben und nach der
+  /// Partitionierung an Ort und Stelle wieder eingehaengt. Das groessere
+  /// Teilsegment wird auf einen Stack gelegt, das kleinere sofort bearbeitet,
+  /// so dass der Stack hoechstens log2(n) Eintraege hat. Wie bei Introsort
+  /// wird ein Segment nach 2*log2(n) Partitionierungsebenen per Mergesort
+  /// sortiert, womit die Laufzeit im schlechtesten Fall O(n log n) ist.
+  ///
+  /// # Example
+  /// ```c++
+  /// PivotNinther pivot;
+  /// NoSortStats none;
+  /// lst.sort_with(pivot, none); // ohne jede Instrumentierung
+  /// ```
+  template <Partitioning P = Partitioning::TwoWay,
+            size_t NetworkCutoff = default_network_cutoff,
+            typename PivotPolicy, typename Stats>
+  void sort_with(PivotPolicy &pivot_policy, Stats &stats) {
+    if (this->size() <=1 ) {return;}
 
-    assert(greater_or_equal.empty());
-    auto pivot = this->pop_front();
+    sort_segment<P, NetworkCutoff>(whole_list_segment(), pivot_policy,
+                                   stats);
+    compact_if_enabled();
+  }
 
-    auto predicate = [&pivot, &num_of_comparisons] (const List::Value& val) { 
-      num_of_comparisons++; 
-      return val >= pivot->get_value(); 
-    };
+  /// Sortiert die Liste parallel auf den Threads von `pool` und gibt die
+  /// Anzahl der Vergleiche zurueck. Wie bei `sort_with` werden Segmente an Ort
+  /// und Stelle partitioniert; da Segmente disjunkt sind und ihre Vorgaenger
+  /// (Pivots) nicht mehr bewegt werden, koennen sie unabhaengig voneinander
+  /// bearbeitet werden. Das groessere Teilsegment wird als neuer Task
+  /// gestartet, bis ein Segment hoechstens `sequential_cutoff` Elemente hat
+  /// und sequentiell sortiert wird. Jeder Task erhaelt eine eigene Kopie der
+  /// Pivot-Policy.
+  ///
+  /// # Example
+  /// ```c++
+  /// ThreadPool pool(8);
+  /// lst.parallel_sort(pool);
+  /// lst.parallel_sort<PivotMedianOfThree>(pool, 1 << 12);
+  /// ```
+  template <typename PivotPolicy = PivotFirst,
+            Partitioning P = Partitioning::TwoWay,
+            size_t NetworkCutoff = default_network_cutoff>
+  uint64_t parallel_sort(ThreadPool &pool, size_t sequential_cutoff = 1 << 14,
+                         PivotPolicy pivot_policy = {}) {
+    SortStats stats;
+    parallel_sort_with<P, NetworkCutoff>(pool, pivot_policy, stats,
+                                         sequential_cutoff);
+    return stats.comparisons;
+  }
 
-    this->move_into_if(greater_or_equal, predicate);
-    num_of_comparisons = greater_or_equal.sort(num_of_comparisons);
-    num_of_comparisons = this->sort(num_of_comparisons);
-    
-    // Anmerkung: Zusammenführen funktioniert nicht richtig...
+  /// Wie `parallel_sort`, zeichnet aber in `stats` auf (siehe `sort_with`).
+  /// Jeder Task zaehlt in einer eigenen Statistik, die erst an seinem Ende
+  /// in `stats` uebernommen wird.
+  template <Partitioning P = Partitioning::TwoWay,
+            size_t NetworkCutoff = default_network_cutoff,
+            typename PivotPolicy, typename Stats>
+  void parallel_sort_with(ThreadPool &pool, const PivotPolicy &pivot_policy,
+                          Stats &stats, size_t sequential_cutoff = 1 << 14) {
+    if (size() <= 1) {return;}
 
-    this->push_back_item(std::move(pivot));
-    this->concat(greater_or_equal);
-    
-    return num_of_comparisons;
+    std::mutex stats_mutex;
+    TaskGroup group(pool);
+    parallel_sort_segment<P, NetworkCutoff>(group, whole_list_segment(),
+                             std::max<size_t>(sequential_cutoff, 1),
+                             pivot_policy, stats, stats_mutex);
+    group.wait();
+    compact_if_enabled();
   }
   
 
+  /// Sortiert die Liste stabil mittels natuerlichem Bottom-up Mergesort und
+  /// gibt die Anzahl der Vergleiche zurueck. Es werden nur Zeiger umgehaengt;
+  /// der zusaetzliche Speicher ist O(1) und die Laufzeit O(n log n) im
+  /// schlechtesten Fall bzw. O(n) auf bereits sortierten Eingaben.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst;
+  /// lst.push_back(3);
+  /// lst.push_back(1);
+  /// lst.push_back(2);
+  /// lst.merge_sort();
+  /// std::cout << lst << std::endl; // gibt "[1, 2, 3]" aus.
+  /// ```
+  uint64_t merge_sort() {
+    SortStats stats;
+    merge_sort(stats);
+    return stats.comparisons;
+  }
+
+  /// Wie `merge_sort()`, zeichnet aber in `stats` auf (siehe `sort_with`).
+  template <typename Stats> void merge_sort(Stats &stats) {
+    if (size() > 1) {
+      merge_sort_segment(dummy, size(), stats);
+      compact_if_enabled();
+    }
+  }
+
+  /// Sortiert eine Liste ganzer Zahlen aufsteigend mittels LSD-Radixsort
+  /// ohne einen einzigen Vergleich. In jedem Durchlauf werden die Knoten
+  /// stabil nach einem Byte des Schluessels auf 256 Buckets verteilt und die
+  /// Buckets danach in O(1) pro Bucket wieder aneinandergehaengt. Bei
+  /// vorzeichenbehafteten Typen wird das Vorzeichenbit gekippt, damit
+  /// negative Werte vor den positiven landen. Durchlaeufe fuer Bytes, die bei
+  /// allen Werten gleich sind, werden uebersprungen.
+  ///
+  /// Gibt die Anzahl der ausgefuehrten Verteilungsdurchlaeufe zurueck.
+  ///
+  /// # Example
+  /// ```c++
+  /// List lst;
+  /// lst.push_back(3);
+  /// lst.push_back(-1);
+  /// lst.push_back(2);
+  /// lst.radix_sort();
+  /// std::cout << lst << std::endl; // gibt "[-1, 2, 3]" aus.
+  /// ```
+  size_t radix_sort() {
+    static_assert(std::is_integral_v<Value>,
+                  "radix_sort ist nur fuer ganzzahlige Werte definiert");
+    static_assert(std::is_same_v<Compare, std::less<Value>>,
+                  "radix_sort sortiert immer aufsteigend");
+
+    constexpr size_t num_bytes = sizeof(Value);
+    if (size() <= 1) {return 0;}
+
+    // Ein Durchlauf zaehlt fuer jedes Byte, wie oft jeder Wert vorkommt.
+    std::array<std::array<size_t, 256>, num_bytes> histogram{};
+    for (const Item *current = dummy.next; current; current = current->next) {
+      const auto key = radix_key(current->get_value());
+      for (size_t byte = 0; byte < num_bytes; ++byte) {
+        ++histogram[byte][(key >> (8 * byte)) & 0xff];
+      }
+    }
+
+    size_t passes = 0;
+    std::array<Link, 256> buckets;
+    std::array<Link *, 256> bucket_tails;
+
+    for (size_t byte = 0; byte < num_bytes; ++byte) {
+      const auto key_of_first = radix_key(dummy.next->get_value());
+      if (histogram[byte][(key_of_first >> (8 * byte)) & 0xff] == size()) {
+        continue;
+      }
+      ++passes;
+
+      for (size_t b = 0; b < 256; ++b) {
+        bucket_tails[b] = &buckets[b];
+      }
+      for (Item *current = dummy.next; current; current = current->next) {
+        const size_t b = (radix_key(current->get_value()) >> (8 * byte)) & 0xff;
+        bucket_tails[b]->next = current;
+        bucket_tails[b] = current;
+      }
+
+      Link *tail = &dummy;
+      for (size_t b = 0; b < 256; ++b) {
+        if (bucket_tails[b] != &buckets[b]) {
+          tail->next = buckets[b].next;
+          tail = bucket_tails[b];
+        }
+      }
+      tail->next = nullptr;
+      last = tail;
+    }
+
+    compact_if_enabled();
+    return passes;
+  }
+
+  /// Ordnet die Werte so auf die Knoten der Liste um, dass aufeinanderfolgende
+  /// Elemente an aufsteigenden Adressen liegen, und verkettet die Knoten in
+  /// dieser Reihenfolge neu. Nach einem Sortieren liegen die Knoten kreuz und
+  /// quer im Speicher; danach laeuft ein Durchlauf wieder sequentiell durch
+  /// die Chunks der Arena, statt pro Element einen Cache-Miss zu erzeugen.
+  ///
+  /// Es werden die vorhandenen Knoten wiederverwendet: Der Allokator wird
+  /// nicht beruehrt, geteilte Arenen und herausgegebene `ItemPtr` bleiben
+  /// gueltig. Belegt die Liste ihre Chunks allein, liegen die Knoten danach
+  /// lueckenlos hintereinander. Temporaer werden ein Zeiger und ein Wert pro
+  /// Element benoetigt; `T` muss verschiebbar zuweisbar sein. Zeiger und
+  /// Iteratoren auf Elemente werden ungueltig.
+  ///
+  /// # Example
+  /// ```c++
+  /// lst.sort();
+  /// lst.compact();
+  /// lst.foreach(...); // sequentieller Speicherzugriff
+  /// ```
+  void compact() {
+    if (size() <= 1) {return;}
+
+    std::vector<Item *> nodes;
+    std::vector<Value> values;
+    nodes.reserve(size());
+    values.reserve(size());
+    for (Item *current = dummy.next; current; current = current->next) {
+      nodes.push_back(current);
+      values.push_back(std::move(current->get_value()));
+    }
+
+    std::sort(nodes.begin(), nodes.end(), std::less<Item *>{});
+
+    Link *tail = &dummy;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      nodes[i]->get_value() = std::move(values[i]);
+      tail->next = nodes[i];
+      tail = nodes[i];
+    }
+    tail->next = nullptr;
+    last = tail;
+  }
+
+  /// Laesst die Sortierverfahren (`sort`, `sort_with`, `parallel_sort`,
+  /// `merge_sort`, `radix_sort`) die Liste anschliessend per `compact`
+  /// umordnen, falls sie mindestens `min_size` Elemente hat. `0` schaltet
+  /// das automatische Umordnen ab (Standard); dann verschieben die
+  /// Sortierverfahren keine Werte.
+  void compact_after_sort(size_t min_size) { auto_compact_min_size = min_size; }
+
 private:
-  Item dummy;
+  Link dummy;
   /// Erweitern Sie die Klasse List um ein privates Datenelement last vom Typ Item*. Es handelt
   /// sich also um einen klassichen Pointer und keinen smart pointer! Dieser soll folgende Datenstruk-
   /// turinvariante erfüllen: last zeigt immer auf den letzten Eintrag der Liste oder auf &dummy, falls
   /// die Liste leer ist.
-  Item* last;
+  Link* last;
 
   size_t num_items{0};
 
-  std::unique_ptr<Item> extract_after(Item &before) {
-    assert(before.next);
+  std::shared_ptr<Allocator> allocator;
 
-    auto popped = std::move(before.next);
-    before.next = std::move(popped->next);
+  Compare compare;
 
-    assert(!popped->next);
+  /// Siehe `move_into_if`; mit `Prefetch` werden die Knoten anhand von
+  /// `hints` im Voraus geladen.
+  template <bool Prefetch, typename Predicate>
+  void move_into_if_impl(PrefetchHints *hints, BasicList &append_to_if_true,
+                         Predicate &predicate) {
+    const size_t initial_size = size() + append_to_if_true.size();
+    (void)initial_size; // verhindert eine Warnung, falls assert wegoptimiert
+    // wurde
+    assert(!this->empty());
+
+    if (append_to_if_true.allocator != allocator) {
+      append_to_if_true.allocator->merge(*allocator);
+    }
+
+    // Verbleibende Knoten (0) und verschobene Knoten (1) werden jeweils an
+    // ihr Ende gehaengt, das ueber das Ergebnis von `predicate` indiziert
+    // wird. So haengt der Kontrollfluss nicht von den Daten ab, und es gibt
+    // keine falsch vorhergesagten Spruenge. Die `next`-Zeiger der Enden werden
+    // erst am Schluss abgeschlossen.
+    std::array<Link *, 2> tails{&dummy, append_to_if_true.last};
+    std::array<size_t, 2> counts{0, 0};
+    if constexpr (Prefetch) {
+      hints->prepare(size());
+    }
+
+    Item *current = dummy.next;
+    for (size_t pos = 0; current; ++pos) {
+      if constexpr (Prefetch) {
+        hints->visit(pos, current);
+      }
+      const size_t move =
+          static_cast<bool>(predicate(std::as_const(*current).get_value()));
+      tails[move]->next = current;
+      tails[move] = current;
+      ++counts[move];
+      current = current->next;
+    }
+    tails[0]->next = nullptr;
+    tails[1]->next = nullptr;
+    last = tails[0];
+    append_to_if_true.last = tails[1];
+    num_items = counts[0];
+    append_to_if_true.num_items += counts[1];
+
+    assert(size() + append_to_if_true.size() == initial_size);
+  }
+
+  template <bool Prefetch>
+  bool is_sorted_impl(PrefetchHints *hints) const {
+    if (empty())
+      return true;
+
+    Item *current = dummy.next;
+    if constexpr (Prefetch) {
+      hints->prepare(size());
+    }
+    for (size_t pos = 0; current->next; ++pos) {
+      if constexpr (Prefetch) {
+        hints->visit(pos, current);
+      }
+      if (less(current->next->get_value(), current->get_value())) {
+        return false;
+      }
+      current = current->next;
+    }
+    return true;
+  }
+
+  /// Siehe `compact_after_sort`; 0 heisst abgeschaltet.
+  size_t auto_compact_min_size{0};
+
+  void compact_if_enabled() {
+    if constexpr (std::is_move_assignable_v<Value>) {
+      if (auto_compact_min_size != 0 && size() >= auto_compact_min_size) {
+        compact();
+      }
+    }
+  }
+
+  bool less(const Value &a, const Value &b) const { return compare(a, b); }
+
+  /// Gibt ein bereits ausgehaengtes Item frei.
+  void destroy_item(Item *item) { ItemDeleter{allocator.get()}(item); }
+
+  /// Gemeinsamer Durchlauf von `set_intersection` (`keep_matched`) und
+  /// `set_difference`: Ein Element dieser Liste mit gleichem Gegenstueck in
+  /// `other` verbraucht dieses Gegenstueck und bleibt genau dann erhalten,
+  /// wenn `keep_matched` gesetzt ist; alle anderen Elemente bleiben genau
+  /// dann erhalten, wenn es nicht gesetzt ist.
+  void filter_sorted(const BasicList &other, bool keep_matched) {
+    Link *tail = &dummy;
+    Item *current = dummy.next;
+    const Item *match = other.dummy.next;
+    while (current) {
+      while (match && less(match->get_value(), current->get_value())) {
+        match = match->next;
+      }
+      const bool matched =
+          match && !less(current->get_value(), match->get_value());
+      if (matched) {
+        match = match->next;
+      }
+
+      Item *next = current->next;
+      if (matched == keep_matched) {
+        tail->next = current;
+        tail = current;
+      } else {
+        destroy_item(current);
+        --num_items;
+      }
+      current = next;
+    }
+    tail->next = nullptr;
+    last = tail;
+  }
+
+  ItemPtr extract_after(Link &before) {
+    if (!before.next) {
+      return ItemPtr(nullptr, ItemDeleter{allocator.get()});
+    }
+
+    Item *popped = before.next;
+    before.next = popped->next;
+    popped->next = nullptr;
 
     // Falls das entferte Element das letzte ist
-    if (before.next.get() == &dummy) {
+    if (!before.next) {
       last = &before;
     }
     num_items--;
 
-    return popped;
+    return ItemPtr(popped, ItemDeleter{allocator.get()});
+  }
+
+  /// Noch zu sortierender Teil der Liste: die `n` Elemente hinter `before`
+  /// auf Partitionierungsebene `depth`.
+  struct Segment {
+    Link *before;
+    size_t n;
+    size_t depth_budget;
+    size_t depth;
+  };
+
+  /// Verteilt die Elemente von `segment` (ohne das bereits ausgehaengte
+  /// `pivot`) auf `< pivot` und `>= pivot` und haengt sie als
+  /// before -> [< pivot] -> pivot -> [>= pivot] -> after
+  /// wieder ein. Gibt die beiden Teilsegmente zurueck.
+  template <typename Stats>
+  std::pair<Segment, Segment> partition_two_way(const Segment &segment,
+                                                Item *pivot, Stats &stats) {
+    Item *less_first = nullptr;
+    Item **less_tail = &less_first;
+    Item *ge_first = nullptr;
+    Item **ge_tail = &ge_first;
+    Item *ge_last = nullptr;
+    size_t num_less = 0;
+
+    Item *current = segment.before->next;
+    for (size_t i = 1; i < segment.n; ++i) {
+      Item *next = current->next;
+      stats.add_comparisons(1);
+      if (less(current->get_value(), pivot->get_value())) {
+        *less_tail = current;
+        less_tail = &current->next;
+        ++num_less;
+      } else {
+        *ge_tail = current;
+        ge_tail = &current->next;
+        ge_last = current;
+      }
+      current = next;
+    }
+
+    Item *after = current;
+    *ge_tail = after;
+    pivot->next = ge_first;
+    *less_tail = pivot;
+    segment.before->next = less_first;
+    if (!after) {
+      last = ge_last ? ge_last : pivot;
+    }
+
+    const size_t num_ge = segment.n - 1 - num_less;
+    stats.add_relinks(segment.n);
+    stats.add_partition(segment.n, std::min(num_less, num_ge));
+
+    const size_t depth_budget = segment.depth_budget - 1;
+    const size_t depth = segment.depth + 1;
+    return {Segment{segment.before, num_less, depth_budget, depth},
+            Segment{pivot, num_ge, depth_budget, depth}};
+  }
+
+  /// Wie `partition_two_way`, sammelt aber alle zum Pivot gleichen Elemente
+  /// direkt hinter dem Pivot:
+  /// before -> [< pivot] -> pivot -> [== pivot] -> [> pivot] -> after.
+  /// Nur die aeusseren Teilsegmente muessen weiter sortiert werden.
+  template <typename Stats>
+  std::pair<Segment, Segment> partition_three_way(const Segment &segment,
+                                                  Item *pivot, Stats &stats) {
+    Item *less_first = nullptr;
+    Item **less_tail = &less_first;
+    Link *equal_last = pivot;
+    Item *greater_first = nullptr;
+    Item **greater_tail = &greater_first;
+    Item *greater_last = nullptr;
+    size_t num_less = 0;
+    size_t num_greater = 0;
+
+    Item *current = segment.before->next;
+    for (size_t i = 1; i < segment.n; ++i) {
+      Item *next = current->next;
+      stats.add_comparisons(1);
+      if (less(current->get_value(), pivot->get_value())) {
+        *less_tail = current;
+        less_tail = &current->next;
+        ++num_less;
+      } else {
+        stats.add_comparisons(1);
+        if (less(pivot->get_value(), current->get_value())) {
+          *greater_tail = current;
+          greater_tail = &current->next;
+          greater_last = current;
+          ++num_greater;
+        } else {
+          equal_last->next = current;
+          equal_last = current;
+        }
+      }
+      current = next;
+    }
+
+    Item *after = current;
+    *greater_tail = after;
+    equal_last->next = greater_first;
+    *less_tail = pivot;
+    segment.before->next = less_first;
+    if (!after) {
+      last = greater_last ? greater_last : equal_last;
+    }
+
+    stats.add_relinks(segment.n);
+    stats.add_partition(segment.n, std::min(num_less, num_greater));
+
+    const size_t depth_budget = segment.depth_budget - 1;
+    const size_t depth = segment.depth + 1;
+    return {Segment{segment.before, num_less, depth_budget, depth},
+            Segment{equal_last, num_greater, depth_budget, depth}};
+  }
+
+  Segment whole_list_segment() {
+    return Segment{&dummy, size(), 2 * floor_log2(size()), 0};
+  }
+
+  /// Waehlt das Pivot von `segment`, haengt es aus und partitioniert das
+  /// Segment. Gibt die beiden noch zu sortierenden Teilsegmente zurueck.
+  template <Partitioning P, typename PivotPolicy, typename Stats>
+  std::pair<Segment, Segment> partition_segment(const Segment &segment,
+                                                PivotPolicy &pivot_policy,
+                                                Stats &stats) {
+    // Pivot aushaengen; es bleibt zwischen den beiden Teilsegmenten.
+    uint64_t pivot_comparisons = 0;
+    Link *before_pivot = pivot_policy.select(segment.before, segment.n,
+                                             compare, pivot_comparisons);
+    stats.add_comparisons(pivot_comparisons);
+    stats.enter_depth(segment.depth);
+    Item *pivot = before_pivot->next;
+    before_pivot->next = pivot->next;
+
+    if constexpr (P == Partitioning::ThreeWay) {
+      return partition_three_way(segment, pivot, stats);
+    } else {
+      return partition_two_way(segment, pivot, stats);
+    }
+  }
+
+  /// Sequentieller Kern von `sort_with` (siehe dort).
+  template <Partitioning P, size_t NetworkCutoff, typename PivotPolicy,
+            typename Stats>
+  void sort_segment(Segment segment, PivotPolicy &pivot_policy,
+                    Stats &stats) {
+    std::array<Segment, 64> stack;
+    size_t stack_size = 0;
+
+    while (true) {
+      while (segment.n > 1) {
+        if constexpr (NetworkCutoff > 1) {
+          if (segment.n <= NetworkCutoff) {
+            stats.enter_depth(segment.depth);
+            network_sort_segment<NetworkCutoff>(segment, stats);
+            break;
+          }
+        }
+        if (segment.depth_budget == 0) {
+          stats.enter_depth(segment.depth);
+          stats.add_fallback();
+          merge_sort_segment(*segment.before, segment.n, stats);
+          break;
+        }
+
+        auto [lower, upper] =
+            partition_segment<P>(segment, pivot_policy, stats);
+
+        if (lower.n > upper.n) {
+          std::swap(lower, upper);
+        }
+        if (upper.n > 1) {
+          assert(stack_size < stack.size());
+          stack[stack_size++] = upper;
+        }
+        segment = lower;
+      }
+
+      if (stack_size == 0) {break;}
+      segment = stack[--stack_size];
+    }
+  }
+
+  /// Task von `parallel_sort`: partitioniert `segment`, bis es klein genug
+  /// fuer `sort_segment` ist, und startet dabei das jeweils groessere
+  /// Teilsegment als eigenen Task.
+  template <Partitioning P, size_t NetworkCutoff, typename PivotPolicy,
+            typename Stats>
+  void parallel_sort_segment(TaskGroup &group, Segment segment,
+                             size_t sequential_cutoff,
+                             PivotPolicy pivot_policy, Stats &total_stats,
+                             std::mutex &stats_mutex) {
+    Stats stats;
+    while (segment.n > sequential_cutoff && segment.depth_budget > 0) {
+      auto [lower, upper] =
+          partition_segment<P>(segment, pivot_policy, stats);
+      if (lower.n > upper.n) {
+        std::swap(lower, upper);
+      }
+      if (upper.n > 1) {
+        group.run([this, &group, upper = upper, sequential_cutoff,
+                   pivot_policy, &total_stats, &stats_mutex] {
+          parallel_sort_segment<P, NetworkCutoff>(group, upper,
+                                                  sequential_cutoff,
+                                                  pivot_policy, total_stats,
+                                                  stats_mutex);
+        });
+      }
+      segment = lower;
+    }
+    sort_segment<P, NetworkCutoff>(segment, pivot_policy, stats);
+    if constexpr (Stats::enabled) {
+      std::lock_guard<std::mutex> lock(stats_mutex);
+      total_stats.merge(stats);
+    }
+  }
+
+  /// Basisfall von `sort_segment`: sortiert die Knotenzeiger des Segments
+  /// (hoechstens `NetworkCutoff` Elemente) per Sortiernetzwerk und verkettet
+  /// die Knoten in dieser Reihenfolge neu.
+  template <size_t NetworkCutoff, typename Stats>
+  void network_sort_segment(const Segment &segment, Stats &stats) {
+    static_assert(NetworkCutoff <= 64,
+                  "Sortiernetzwerke nur fuer hoechstens 64 Elemente");
+    std::array<Item *, NetworkCutoff> items{};
+    Item *current = segment.before->next;
+    for (size_t i = 0; i < segment.n; ++i) {
+      items[i] = current;
+      current = current->next;
+    }
+
+    auto less_item = [this](const Item *a, const Item *b) {
+      return less(a->get_value(), b->get_value());
+    };
+    stats.add_comparisons(sorting_network::sort_up_to<NetworkCutoff>(
+        items.data(), segment.n, less_item));
+
+    segment.before->next = items[0];
+    for (size_t i = 0; i + 1 < segment.n; ++i) {
+      items[i]->next = items[i + 1];
+    }
+    items[segment.n - 1]->next = current;
+    if (!current) {
+      last = items[segment.n - 1];
+    }
+    stats.add_relinks(segment.n + 1);
+  }
+
+  /// Bildet einen Wert auf einen vorzeichenlosen Schluessel gleicher Ordnung
+  /// ab (fuer `radix_sort`).
+  static auto radix_key(const Value &val) {
+    using Key = std::make_unsigned_t<Value>;
+    Key key = static_cast<Key>(val);
+    if constexpr (std::is_signed_v<Value>) {
+      key ^= Key{1} << (8 * sizeof(Value) - 1);
+    }
+    return key;
+  }
+
+  static size_t floor_log2(size_t n) {
+    size_t log = 0;
+    while (n >>= 1) {
+      ++log;
+    }
+    return log;
+  }
+
+  /// Trennt die Kette hinter den ersten `n` Elementen ab `first` ab und gibt
+  /// den Rest zurueck (nullptr, falls die Kette nicht laenger ist).
+  static Item *split_after(Item *first, size_t n) {
+    for (size_t i = 1; first && i < n; ++i) {
+      first = first->next;
+    }
+    if (!first) {return nullptr;}
+    Item *rest = first->next;
+    first->next = nullptr;
+    return rest;
+  }
+
+  /// Verschmilzt die sortierten Ketten `left` und `right` stabil, haengt das
+  /// Ergebnis hinter `tail` an und gibt das neue letzte Element zurueck.
+  template <typename Stats>
+  Link *merge_chains(Item *left, Item *right, Link *tail, Stats &stats) const {
+    while (left && right) {
+      stats.add_comparisons(1);
+      stats.add_relinks(1);
+      if (less(right->get_value(), left->get_value())) {
+        tail->next = right;
+        right = right->next;
+      } else {
+        tail->next = left;
+        left = left->next;
+      }
+      tail = tail->next;
+    }
+    tail->next = left ? left : right;
+    stats.add_relinks(1);
+    while (tail->next) {
+      tail = tail->next;
+    }
+    return tail;
+  }
+
+  /// Trennt den maximalen aufsteigenden Lauf ab `first` ab und gibt den Rest
+  /// zurueck (nullptr, falls die Kette nur aus diesem Lauf besteht).
+  template <typename Stats>
+  Item *split_run(Item *first, Stats &stats) const {
+    while (first->next) {
+      stats.add_comparisons(1);
+      if (less(first->next->get_value(), first->get_value())) {
+        Item *rest = first->next;
+        first->next = nullptr;
+        return rest;
+      }
+      first = first->next;
+    }
+    return nullptr;
+  }
+
+  /// Natuerlicher Bottom-up Mergesort der `n` Elemente hinter `before` mit
+  /// O(1) zusaetzlichem Speicher: Jeder Durchlauf verschmilzt benachbarte
+  /// aufsteigende Laeufe paarweise, bis nur noch ein Lauf uebrig ist.
+  template <typename Stats>
+  void merge_sort_segment(Link &before, size_t n, Stats &stats) {
+    Item *after = split_after(before.next, n);
+
+    Link *tail = &before;
+    for (size_t runs = 2; runs > 1;) {
+      Item *rest = before.next;
+      tail = &before;
+      runs = 0;
+      while (rest) {
+        Item *left = rest;
+        Item *right = split_run(left, stats);
+        rest = right ? split_run(right, stats) : nullptr;
+        tail = merge_chains(left, right, tail, stats);
+        ++runs;
+      }
+    }
+
+    tail->next = after;
+    if (!after) {
+      last = tail;
+    }
   }
 };
 
+/// Liste von ints mit Arena-Allokator (Standard).
+using List = BasicList<>;
+
+/// Liste von ints, deren Knoten einzeln auf dem Heap angelegt werden.
+using HeapList = BasicList<int, std::less<int>, HeapAllocator<ListItem<int>>>;
+
 #endif // LIST_HPP
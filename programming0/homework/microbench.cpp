@@ -0,0 +1,198 @@
+#include "fstream"
+#include "list.hpp"
+#include "workload.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+// Microbenchmarks fuer die einzelnen Operationen von List (Arena) und
+// HeapList. Jede Messung besteht aus einer Vorbereitung (nicht gemessen) und
+// einem Lauf, der `ops` Operationen ausfuehrt. Nach `warmup` verworfenen
+// Laeufen werden `repeats` Laeufe gemessen; Mittelwert, Standardabweichung,
+// Median und Minimum der Zeit pro Operation landen in microbench.csv.
+
+// Verhindert, dass der Compiler Ergebnisse wegoptimiert.
+volatile int64_t sink;
+
+struct BenchResult {
+  std::string op;
+  std::string list;
+  size_t num_items;
+  size_t ops;
+  std::vector<double> ns_per_op;
+};
+
+struct BenchConfig {
+  size_t warmup;
+  size_t repeats;
+  std::string filter;
+};
+
+template <typename Setup, typename Run>
+void measure(const BenchConfig &config, const char *op, const char *list,
+             size_t n, size_t ops, Setup &&setup, Run &&run,
+             std::vector<BenchResult> &results) {
+  using Clock = std::chrono::steady_clock;
+  if (!config.filter.empty() && config.filter != op) {
+    return;
+  }
+
+  BenchResult result{op, list, n, ops, {}};
+  for (size_t rep = 0; rep < config.warmup + config.repeats; ++rep) {
+    auto state = setup();
+    const auto start = Clock::now();
+    run(state);
+    const auto time = Clock::now() - start;
+    if (rep >= config.warmup) {
+      result.ns_per_op.push_back(
+          static_cast<double>(std::chrono::nanoseconds(time).count()) / ops);
+    }
+  }
+  results.push_back(std::move(result));
+}
+
+template <typename ListType>
+void bench_list(const BenchConfig &config, const char *name, size_t n,
+                std::vector<BenchResult> &results) {
+  std::mt19937_64 gen(0x123456789);
+  const auto values = make_input("random", n, gen);
+  auto filled = [&] {
+    return std::make_unique<ListType>(values.begin(), values.end());
+  };
+  auto empty = [] { return std::make_unique<ListType>(); };
+
+  measure(config, "push_front", name, n, n, empty, [&](auto &list) {
+    for (int val : values) {
+      list->push_front(val);
+    }
+  }, results);
+
+  measure(config, "push_back", name, n, n, empty, [&](auto &list) {
+    for (int val : values) {
+      list->push_back(val);
+    }
+  }, results);
+
+  measure(config, "pop_front", name, n, n, filled, [&](auto &list) {
+    int64_t sum = 0;
+    while (auto item = list->pop_front()) {
+      sum += item->get_value();
+    }
+    sink = sum;
+  }, results);
+
+  // Die Items stammen aus dem Allokator der Ziel-Liste.
+  measure(config, "push_back_item", name, n, n,
+          [&] {
+            auto list = std::make_unique<ListType>();
+            std::vector<typename ListType::ItemPtr> items;
+            items.reserve(n);
+            for (int val : values) {
+              items.push_back(list->make_item(val));
+            }
+            return std::make_pair(std::move(list), std::move(items));
+          },
+          [&](auto &state) {
+            for (auto &item : state.second) {
+              state.first->push_back_item(std::move(item));
+            }
+          },
+          results);
+
+  // Beide Listen teilen sich den Allokator, es wird also nur umgehaengt.
+  measure(config, "move_into_if", name, n, n,
+          [&] {
+            auto list = filled();
+            auto target = std::make_unique<ListType>(list->get_allocator());
+            return std::make_pair(std::move(list), std::move(target));
+          },
+          [&](auto &state) {
+            state.first->move_into_if(*state.second,
+                                      [](int val) { return val % 2 == 0; });
+          },
+          results);
+
+  // concat ist O(1): Die beiden Listen werden wiederholt hin und her
+  // gehaengt.
+  constexpr size_t concat_rounds = 1000;
+  measure(config, "concat", name, n, 2 * concat_rounds,
+          [&] {
+            auto list = filled();
+            auto other = std::make_unique<ListType>(list->get_allocator());
+            other->push_back(0);
+            return std::make_pair(std::move(list), std::move(other));
+          },
+          [&](auto &state) {
+            for (size_t i = 0; i < concat_rounds; ++i) {
+              state.first->concat(*state.second);
+              state.second->concat(*state.first);
+            }
+            sink = static_cast<int64_t>(state.second->size());
+          },
+          results);
+
+  measure(config, "foreach", name, n, n, filled, [&](auto &list) {
+    int64_t sum = 0;
+    list->foreach ([&sum](const int &val) { sum += val; });
+    sink = sum;
+  }, results);
+
+  measure(config, "is_sorted", name, n, n,
+          [&] {
+            auto list = filled();
+            list->sort();
+            return list;
+          },
+          [&](auto &list) { sink = list->is_sorted(); }, results);
+
+  measure(config, "destroy", name, n, n, filled,
+          [&](auto &list) { list.reset(); }, results);
+}
+
+int main(int argc, char **argv) {
+  constexpr size_t min_n = 1 << 5;
+  constexpr size_t max_n = 1 << 20;
+
+  // `./microbench [op]` misst alle (oder nur die angegebene) Operationen.
+  const BenchConfig config{3, 15, argc > 1 ? argv[1] : ""};
+
+  std::vector<BenchResult> results;
+  for (size_t n = min_n; n <= max_n; n *= 4) {
+    std::cout << "n=" << n << std::endl;
+    bench_list<List>(config, "list", n, results);
+    bench_list<HeapList>(config, "heap", n, results);
+  }
+
+  std::ofstream output;
+  output.open("microbench.csv");
+  output << "op,list,num_items,ops,repeats,mean_ns_per_op,stddev_ns_per_op,"
+            "median_ns_per_op,min_ns_per_op\n";
+  for (auto &x : results) {
+    auto &times = x.ns_per_op;
+    const double mean = std::accumulate(times.begin(), times.end(), 0.0) /
+                        static_cast<double>(times.size());
+    double variance = 0;
+    for (double t : times) {
+      variance += (t - mean) * (t - mean);
+    }
+    variance /= static_cast<double>(std::max<size_t>(times.size() - 1, 1));
+    std::sort(times.begin(), times.end());
+
+    output << x.op << "," << x.list << "," << x.num_items << "," << x.ops
+           << "," << times.size() << "," << mean << "," << std::sqrt(variance)
+           << "," << times[times.size() / 2] << "," << times.front() << "\n";
+    if (x.num_items * 4 > max_n) {
+      std::cout << x.op << " " << x.list << " n=" << x.num_items << " "
+                << mean << " +- " << std::sqrt(variance) << " ns/op\n";
+    }
+  }
+
+  return 0;
+}
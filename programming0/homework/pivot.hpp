@@ -0,0 +1,130 @@
+#ifndef PIVOT_HPP
+#define PIVOT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+/// Pivot-Policies fuer `BasicList::sort`.
+///
+/// Jede Policy besitzt eine Methode
+/// `Link *select(Link *before_first, size_t n, const Compare &less,
+///               uint64_t &comparisons)`,
+/// die ein Item aus der (nicht-leeren) Teilliste mit `n` Elementen hinter
+/// `before_first` auswaehlt und dessen *Vorgaenger* zurueckgibt, damit die
+/// Liste das Pivot-Element in O(1) aushaengen kann. Vergleiche mittels `less`,
+/// die fuer die Auswahl noetig sind, werden auf `comparisons` addiert.
+
+namespace pivot_detail {
+
+/// Laeuft einmal durch die Liste und sammelt die Vorgaenger der Elemente an
+/// den (aufsteigend sortierten) Positionen `positions`.
+template <typename Link, size_t K>
+std::array<Link *, K> predecessors_at(Link *before_first,
+                                      const std::array<size_t, K> &positions) {
+  std::array<Link *, K> result{};
+  Link *before = before_first;
+  size_t pos = 0;
+  for (size_t i = 0; i < K; ++i) {
+    while (pos < positions[i]) {
+      before = before->next;
+      ++pos;
+    }
+    result[i] = before;
+  }
+  return result;
+}
+
+/// Gibt den Vorgaenger des Medians der Nachfolger von `a`, `b` und `c` zurueck.
+template <typename Link, typename Compare>
+Link *median_of_three(Link *a, Link *b, Link *c, const Compare &less,
+                      uint64_t &comparisons) {
+  const auto &va = a->next->get_value();
+  const auto &vb = b->next->get_value();
+  const auto &vc = c->next->get_value();
+
+  comparisons += 2;
+  if (less(va, vb)) {
+    if (less(vb, vc))
+      return b;
+    ++comparisons;
+    return less(va, vc) ? c : a;
+  } else {
+    if (less(va, vc))
+      return a;
+    ++comparisons;
+    return less(vb, vc) ? c : b;
+  }
+}
+
+/// Gleichmaessig verteilte Positionen 0, ..., n-1 fuer K Stichproben.
+template <size_t K> std::array<size_t, K> even_positions(size_t n) {
+  std::array<size_t, K> positions{};
+  for (size_t i = 0; i < K; ++i)
+    positions[i] = i * (n - 1) / (K - 1);
+  return positions;
+}
+
+} // namespace pivot_detail
+
+/// Waehlt immer das erste Element (urspruengliches Verhalten). Auf sortierten
+/// oder umgekehrt sortierten Eingaben entstehen so maximal unbalancierte
+/// Partitionen, bis `sort` auf Mergesort ausweicht.
+struct PivotFirst {
+  template <typename Link, typename Compare>
+  Link *select(Link *before_first, size_t, const Compare &, uint64_t &) {
+    return before_first;
+  }
+};
+
+/// Waehlt ein gleichverteilt zufaelliges Element. Der Seed ist fest, damit
+/// Messungen reproduzierbar bleiben.
+struct PivotRandom {
+  std::mt19937_64 gen{0x5eed};
+
+  template <typename Link, typename Compare>
+  Link *select(Link *before_first, size_t n, const Compare &, uint64_t &) {
+    const size_t pos = std::uniform_int_distribution<size_t>(0, n - 1)(gen);
+    return pivot_detail::predecessors_at<Link, 1>(before_first, {pos})[0];
+  }
+};
+
+/// Median aus erstem, mittlerem und letztem Element.
+struct PivotMedianOfThree {
+  template <typename Link, typename Compare>
+  Link *select(Link *before_first, size_t n, const Compare &less,
+               uint64_t &comparisons) {
+    if (n < 3)
+      return before_first;
+    const auto pred = pivot_detail::predecessors_at(
+        before_first, pivot_detail::even_positions<3>(n));
+    return pivot_detail::median_of_three(pred[0], pred[1], pred[2], less,
+                                         comparisons);
+  }
+};
+
+/// Tukeys Ninther: Median der Mediane von drei Dreiergruppen aus neun
+/// gleichmaessig verteilten Stichproben, die in einem einzigen Durchlauf
+/// eingesammelt werden. Fuer kurze Listen wird Median-of-three verwendet.
+struct PivotNinther {
+  static constexpr size_t min_size = 27;
+
+  template <typename Link, typename Compare>
+  Link *select(Link *before_first, size_t n, const Compare &less,
+               uint64_t &comparisons) {
+    if (n < min_size)
+      return PivotMedianOfThree{}.select(before_first, n, less, comparisons);
+
+    const auto pred = pivot_detail::predecessors_at(
+        before_first, pivot_detail::even_positions<9>(n));
+    using pivot_detail::median_of_three;
+    return median_of_three(
+        median_of_three(pred[0], pred[1], pred[2], less, comparisons),
+        median_of_three(pred[3], pred[4], pred[5], less, comparisons),
+        median_of_three(pred[6], pred[7], pred[8], less, comparisons), less,
+        comparisons);
+  }
+};
+
+#endif // PIVOT_HPP
@@ -1,50 +1,1259 @@
+// Die Zaehlung der Allokationen (Modus "memory") ersetzt die globalen
+// `operator new`/`operator delete` und verfaelscht damit alle anderen
+// Messungen. Sie steckt daher nur im eigenen Programm sort_memory, das aus
+// dieser Datei mit -DALLOC_TRACKING_REPLACE_NEW gebaut wird.
+#include "alloc_tracking.hpp"
+
 #include "fstream"
 #include "list.hpp"
+#include "sorted_list.hpp"
+#include "splitter_tree.hpp"
+#include "unrolled_list.hpp"
+#include "workload.hpp"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <forward_list>
 #include <iostream>
+#include <list>
 #include <numeric>
 #include <random>
+#include <string>
 #include <vector>
 
-std::vector<std::pair<size_t, uint64_t>>
-count_number_of_compares(size_t min_n, size_t max_n, uint64_t repeats) {
-  std::vector<std::pair<size_t, uint64_t>> results;
+// Ruft `callback` mit einer Instanz der Pivot-Policy namens `name` auf.
+// Gibt `false` zurueck, falls es keine Policy dieses Namens gibt.
+template <typename Callback>
+bool with_pivot_policy(const std::string &name, Callback &&callback) {
+  if (name == "first") {
+    callback(PivotFirst{});
+  } else if (name == "random") {
+    callback(PivotRandom{});
+  } else if (name == "median3") {
+    callback(PivotMedianOfThree{});
+  } else if (name == "ninther") {
+    callback(PivotNinther{});
+  } else {
+    std::cerr << "Unbekannte Pivot-Policy: " << name << "\n";
+    return false;
+  }
+  return true;
+}
 
-  std::mt19937_64 gen(0x123456789);
+// Ruft `callback` mit einer Funktion auf, die eine Liste mit dem Verfahren
+// `name` sortiert und dabei in einer SortStats zaehlt. Neben den
+// Pivot-Policies des QuickSorts gibt es "merge" fuer List::merge_sort und
+// "radix" fuer List::radix_sort (ohne Vergleiche); der Suffix "-3way" waehlt
+// die Dreiwege-Partitionierung.
+template <typename Callback>
+bool with_sort_engine(const std::string &name, Callback &&callback) {
+  if (name == "merge") {
+    callback([](List &list, SortStats &stats) { list.merge_sort(stats); });
+    return true;
+  }
+  if (name == "radix") {
+    callback([](List &list, SortStats &) { list.radix_sort(); });
+    return true;
+  }
+  const std::string suffix = "-3way";
+  if (name.size() > suffix.size() &&
+      name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+    const std::string pivot = name.substr(0, name.size() - suffix.size());
+    return with_pivot_policy(pivot, [&](auto pivot_policy) {
+      callback([pivot_policy](List &list, SortStats &stats) mutable {
+        list.sort_with<Partitioning::ThreeWay>(pivot_policy, stats);
+      });
+    });
+  }
+  return with_pivot_policy(name, [&](auto pivot_policy) {
+    callback([pivot_policy](List &list, SortStats &stats) mutable {
+      list.sort_with(pivot_policy, stats);
+    });
+  });
+}
 
+// Erzeugt den Zufallsgenerator fuer die Wiederholung `rep` mit n Elementen.
+// Jeder Job erhaelt einen eigenen, allein aus `master_seed`, n und rep
+// abgeleiteten Strom, so dass die Eingaben nicht von der Reihenfolge der
+// Jobs oder der Anzahl der Threads abhaengen.
+std::mt19937_64 job_generator(uint64_t master_seed, size_t n, size_t rep) {
+  std::seed_seq seed{static_cast<uint32_t>(master_seed),
+                     static_cast<uint32_t>(master_seed >> 32),
+                     static_cast<uint32_t>(n), static_cast<uint32_t>(rep)};
+  return std::mt19937_64(seed);
+}
+
+// Zaehlt die Vergleiche von `sort_engine` auf Eingaben der Form `shape`
+// (siehe make_input). Die unabhaengigen (n, Wiederholung)-Jobs laufen auf
+// `pool`; jeder Job sortiert mit einer eigenen Kopie von `sort_engine`. Die
+// Ergebnisse stehen unabhaengig von der Anzahl der Threads immer in
+// derselben Reihenfolge (nach n, dann nach Wiederholung).
+template <typename SortEngine>
+std::vector<std::pair<size_t, uint64_t>>
+count_number_of_compares(size_t min_n, size_t max_n, uint64_t repeats,
+                         SortEngine sort_engine, const std::string &shape,
+                         ThreadPool &pool) {
+  constexpr uint64_t master_seed = 0x123456789;
+
+  std::vector<size_t> sizes;
   for (size_t n = min_n; n <= max_n; n *= 2) {
-    std::cout << "n=" << n << std::endl;
+    sizes.push_back(n);
+  }
+
+  std::vector<std::pair<size_t, uint64_t>> results(sizes.size() * repeats);
+  std::atomic<bool> all_sorted{true};
 
+  TaskGroup group(pool);
+  // Die grossen Jobs zuerst starten, damit sie nicht am Ende allein laufen.
+  for (size_t i = sizes.size(); i-- > 0;) {
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      group.run([&, n = sizes[i], rep, job = i * repeats + rep,
+                 sort_engine]() mutable {
+        auto gen = job_generator(master_seed, n, rep);
+        const auto values = make_input(shape, n, gen);
+        List list(values.begin(), values.end());
+
+        SortStats stats;
+        sort_engine(list, stats);
+        if (!list.is_sorted()) {
+          all_sorted = false;
+        }
+        results[job] = {n, stats.comparisons};
+      });
+    }
+  }
+  group.wait();
+
+  if (!all_sorted) {
+    std::cout << "Liste ist nicht sortiert\n";
+    return {};
+  }
+  return results;
+}
+
+struct AllocResult {
+  std::string allocator;
+  size_t num_items;
+  uint64_t build_ns;
+  uint64_t destroy_ns;
+};
+
+// Misst, wie lange Aufbau und Abbau (Destruktor) einer Liste mit n Elementen
+// fuer die Allokator-Policy der Liste `ListType` dauern. Aufgebaut wird
+// entweder elementweise mit push_back oder (`bulk`) mit einem append_range
+// aus einem vorbereiteten Vektor.
+template <typename ListType>
+void measure_build_destroy(const char *name, bool bulk, size_t min_n,
+                           size_t max_n, uint64_t repeats,
+                           std::vector<AllocResult> &results) {
+  using Clock = std::chrono::steady_clock;
+
+  for (size_t n = min_n; n <= max_n; n *= 2) {
     std::vector<int> values(n);
     std::iota(values.begin(), values.end(), 0);
 
     for (size_t rep = 0; rep < repeats; ++rep) {
-      std::shuffle(values.begin(), values.end(), gen);
+      auto list = std::make_unique<ListType>();
+
+      const auto start = Clock::now();
+      if (bulk) {
+        list->append_range(values);
+      } else {
+        for (size_t i = 0; i < n; ++i) {
+          list->push_back(static_cast<int>(i));
+        }
+      }
+      const auto built = Clock::now();
+      list.reset();
+      const auto destroyed = Clock::now();
+
+      results.push_back(
+          {name, n,
+           static_cast<uint64_t>(
+               std::chrono::nanoseconds(built - start).count()),
+           static_cast<uint64_t>(
+               std::chrono::nanoseconds(destroyed - built).count())});
+    }
+  }
+}
+
+int run_alloc_benchmark(size_t min_n, size_t max_n, uint64_t repeats) {
+  std::vector<AllocResult> results;
+  measure_build_destroy<HeapList>("heap", false, min_n, max_n, repeats,
+                                  results);
+  measure_build_destroy<List>("arena", false, min_n, max_n, repeats, results);
+  measure_build_destroy<List>("arena-bulk", true, min_n, max_n, repeats,
+                              results);
+
+  std::ofstream output;
+  output.open("alloc.csv");
+  output << "allocator,num_items,build_ns,destroy_ns\n";
+
+  for (auto &x : results) {
+    output << x.allocator << "," << x.num_items << "," << x.build_ns << ","
+           << x.destroy_ns << "\n";
+    if (x.num_items == max_n) {
+      std::cout << x.allocator << " n=" << x.num_items
+                << " build=" << x.build_ns / 1000 << "us"
+                << " destroy=" << x.destroy_ns / 1000 << "us\n";
+    }
+  }
+
+  return 0;
+}
+
+struct EngineResult {
+  std::string engine;
+  std::string shape;
+  size_t num_items;
+  SortStats stats;
+  uint64_t time_ns;
+};
+
+// Vergleicht die Sortierverfahren `engines` (siehe with_sort_engine) auf
+// den Eingabeformen `shapes` (siehe make_input) und schreibt die SortStats
+// und die Laufzeit nach `filename`.
+int run_engine_benchmark(const std::string &filename,
+                         const std::vector<std::string> &engines,
+                         const std::vector<std::string> &shapes, size_t min_n,
+                         size_t max_n, uint64_t repeats) {
+  using Clock = std::chrono::steady_clock;
+  std::vector<EngineResult> results;
+
+  for (const std::string &engine : engines) {
+    for (const std::string &shape : shapes) {
+      std::mt19937_64 gen(0x123456789);
+
+      for (size_t n = min_n; n <= max_n; n *= 2) {
+        for (size_t rep = 0; rep < repeats; ++rep) {
+          const auto values = make_input(shape, n, gen);
+          List list(values.begin(), values.end());
+
+          SortStats stats;
+          const auto start = Clock::now();
+          with_sort_engine(engine, [&](auto sort_engine) {
+            sort_engine(list, stats);
+          });
+          const auto time = Clock::now() - start;
 
-      List list;
+          if (!list.is_sorted()) {
+            std::cout << "Liste ist nicht sortiert\n";
+            return 1;
+          }
+
+          results.push_back(
+              {engine, shape, n, stats,
+               static_cast<uint64_t>(
+                   std::chrono::nanoseconds(time).count())});
+        }
+      }
+    }
+  }
+
+  std::ofstream output;
+  output.open(filename);
+  output << "engine,shape,num_items,num_compares,num_relinks,max_depth,"
+            "balance,fallbacks,time_ns\n";
+  for (auto &x : results) {
+    output << x.engine << "," << x.shape << "," << x.num_items << ","
+           << x.stats.comparisons << "," << x.stats.relinks << ","
+           << x.stats.max_depth << "," << x.stats.balance() << ","
+           << x.stats.fallbacks << "," << x.time_ns << "\n";
+  }
+
+  return 0;
+}
+
+struct LayoutResult {
+  std::string layout;
+  size_t num_items;
+  uint64_t traverse_ns;
+  uint64_t sort_ns;
+};
+
+// Misst fuer den Listentyp `ListType`, wie lange ein Durchlauf mit foreach
+// und is_sorted sowie das Sortieren einer zufaelligen Permutation dauern.
+template <typename ListType>
+void measure_layout(const char *name, size_t min_n, size_t max_n,
+                    uint64_t repeats, std::vector<LayoutResult> &results) {
+  using Clock = std::chrono::steady_clock;
+  std::mt19937_64 gen(0x123456789);
+
+  for (size_t n = min_n; n <= max_n; n *= 2) {
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      const auto values = make_input("random", n, gen);
+      ListType list;
       for (auto &&x : values) {
         list.push_back(x);
       }
 
-      const auto compares = list.sort();
+      const auto start = Clock::now();
+      int64_t sum = 0;
+      list.foreach ([&sum](const int &val) { sum += val; });
+      const bool sorted = list.is_sorted();
+      const auto traversed = Clock::now();
+      list.sort();
+      const auto finished = Clock::now();
+
+      if (sorted || !list.is_sorted() ||
+          sum != static_cast<int64_t>(n * (n - 1) / 2)) {
+        std::cout << "Liste ist nicht sortiert\n";
+        return;
+      }
+
+      results.push_back(
+          {name, n,
+           static_cast<uint64_t>(
+               std::chrono::nanoseconds(traversed - start).count()),
+           static_cast<uint64_t>(
+               std::chrono::nanoseconds(finished - traversed).count())});
+    }
+  }
+}
+
+int run_layout_benchmark(size_t min_n, size_t max_n, uint64_t repeats) {
+  std::vector<LayoutResult> results;
+  measure_layout<List>("list", min_n, max_n, repeats, results);
+  measure_layout<UnrolledList>("unrolled", min_n, max_n, repeats, results);
+
+  std::ofstream output;
+  output.open("layout.csv");
+  output << "layout,num_items,traverse_ns,sort_ns\n";
+  for (auto &x : results) {
+    output << x.layout << "," << x.num_items << "," << x.traverse_ns << ","
+           << x.sort_ns << "\n";
+  }
+
+  return 0;
+}
+
+struct CompactResult {
+  size_t num_items;
+  uint64_t traverse_before_ns;
+  uint64_t compact_ns;
+  uint64_t traverse_after_ns;
+};
+
+// Misst fuer eine sortierte Liste, wie lange ein Durchlauf (foreach und
+// is_sorted) vor und nach List::compact dauert und was das Umordnen kostet.
+int run_compact_benchmark(size_t min_n, size_t max_n, uint64_t repeats) {
+  using Clock = std::chrono::steady_clock;
+  auto elapsed_ns = [](Clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::nanoseconds(Clock::now() - start).count());
+  };
+
+  std::vector<CompactResult> results;
+  std::mt19937_64 gen(0x123456789);
+  for (size_t n = min_n; n <= max_n; n *= 2) {
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      const auto values = make_input("random", n, gen);
+      List list(values.begin(), values.end());
+      list.sort<PivotMedianOfThree>();
+
+      int64_t sum_before = 0;
+      auto start = Clock::now();
+      list.foreach ([&](const int &val) { sum_before += val; });
+      bool sorted = list.is_sorted();
+      const uint64_t before_ns = elapsed_ns(start);
+
+      start = Clock::now();
+      list.compact();
+      const uint64_t compact_ns = elapsed_ns(start);
+
+      int64_t sum_after = 0;
+      start = Clock::now();
+      list.foreach ([&](const int &val) { sum_after += val; });
+      sorted = list.is_sorted() && sorted;
+      const uint64_t after_ns = elapsed_ns(start);
+
+      if (!sorted || sum_before != sum_after) {
+        std::cout << "Liste ist nicht sortiert\n";
+        return 1;
+      }
+      results.push_back({n, before_ns, compact_ns, after_ns});
+    }
+  }
+
+  std::ofstream output;
+  output.open("compact.csv");
+  output << "num_items,traverse_before_ns,compact_ns,traverse_after_ns\n";
+  for (auto &x : results) {
+    output << x.num_items << "," << x.traverse_before_ns << ","
+           << x.compact_ns << "," << x.traverse_after_ns << "\n";
+    if (x.num_items == max_n) {
+      std::cout << "n=" << x.num_items
+                << " traverse before=" << x.traverse_before_ns / 1000
+                << "us compact=" << x.compact_ns / 1000
+                << "us traverse after=" << x.traverse_after_ns / 1000
+                << "us\n";
+    }
+  }
+
+  return 0;
+}
+
+struct PrefetchResult {
+  std::string op;
+  size_t num_items;
+  uint64_t plain_ns;
+  uint64_t prefetch_ns;
+};
+
+// Vergleicht foreach, is_sorted und move_into_if ohne und mit PrefetchHints
+// auf sortierten (also im Speicher verstreuten) Listen. Jede Messung umfasst
+// einen vorangehenden foreach-Durchlauf, der mit Prefetch die Hinweise erst
+// anlegt; gemessen werden also zwei Durchlaeufe einschliesslich des Aufbaus
+// der Hinweise. Die groessten Listen sind deutlich groesser als der
+// Last-Level-Cache.
+int run_prefetch_benchmark(size_t min_n, size_t max_n, uint64_t repeats) {
+  using Clock = std::chrono::steady_clock;
+  auto elapsed_ns = [](Clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::nanoseconds(Clock::now() - start).count());
+  };
+  auto is_even = [](const int &val) { return val % 2 == 0; };
+  // Die Summen halten den Compiler davon ab, Durchlaeufe wegzulassen.
+  int64_t sum_plain = 0;
+  int64_t sum_prefetch = 0;
+  auto add_plain = [&](const int &val) { sum_plain += val; };
+  auto add_prefetch = [&](const int &val) { sum_prefetch += val; };
+
+  std::vector<PrefetchResult> results;
+  std::mt19937_64 gen(0x123456789);
+  for (size_t n = min_n; n <= max_n; n *= 2) {
+    std::cout << "n=" << n << std::endl;
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      const auto values = make_input("random", n, gen);
+      List plain(values.begin(), values.end());
+      List prefetch(values.begin(), values.end());
+      plain.radix_sort();
+      prefetch.radix_sort();
+
+      auto start = Clock::now();
+      plain.foreach (add_plain);
+      plain.foreach (add_plain);
+      const uint64_t foreach_plain_ns = elapsed_ns(start);
+
+      start = Clock::now();
+      PrefetchHints hints;
+      prefetch.foreach(hints, add_prefetch);
+      prefetch.foreach(hints, add_prefetch);
+      results.push_back({"foreach", n, foreach_plain_ns, elapsed_ns(start)});
+
+      start = Clock::now();
+      plain.foreach (add_plain);
+      bool sorted = plain.is_sorted();
+      const uint64_t is_sorted_plain_ns = elapsed_ns(start);
+      start = Clock::now();
+      PrefetchHints sorted_hints;
+      prefetch.foreach(sorted_hints, add_prefetch);
+      sorted = prefetch.is_sorted(sorted_hints) && sorted;
+      results.push_back(
+          {"is_sorted", n, is_sorted_plain_ns, elapsed_ns(start)});
+
+      List plain_even(plain.get_allocator());
+      List prefetch_even(prefetch.get_allocator());
+      start = Clock::now();
+      plain.foreach (add_plain);
+      plain.move_into_if(plain_even, is_even);
+      const uint64_t move_plain_ns = elapsed_ns(start);
+      start = Clock::now();
+      PrefetchHints move_hints;
+      prefetch.foreach(move_hints, add_prefetch);
+      prefetch.move_into_if(move_hints, prefetch_even, is_even);
+      results.push_back(
+          {"move_into_if", n, move_plain_ns, elapsed_ns(start)});
+
+      if (!sorted || sum_plain != sum_prefetch ||
+          plain_even.size() != prefetch_even.size()) {
+        std::cout << "Ergebnisse mit und ohne Prefetch weichen ab\n";
+        return 1;
+      }
+    }
+  }
+
+  std::ofstream output;
+  output.open("prefetch.csv");
+  output << "op,num_items,plain_ns,prefetch_ns\n";
+  for (auto &x : results) {
+    output << x.op << "," << x.num_items << "," << x.plain_ns << ","
+           << x.prefetch_ns << "\n";
+    if (x.num_items == max_n) {
+      std::cout << x.op << " n=" << x.num_items
+                << " plain=" << x.plain_ns / 1000
+                << "us prefetch=" << x.prefetch_ns / 1000 << "us\n";
+    }
+  }
+
+  return 0;
+}
+
+struct SortedListResult {
+  size_t num_items;
+  uint64_t build_ns;
+  double find_ns;
+  double linear_find_ns;
+  double insert_ns;
+  double erase_ns;
+};
+
+// Vergleicht Punktanfragen auf einer SortedList mit der linearen Suche in
+// einer sortierten List und misst Aufbau, Einfuegen und Entfernen. Die
+// lineare Suche wird nur mit wenigen Anfragen gemessen, da sie O(n) dauert.
+int run_sorted_list_benchmark(size_t min_n, size_t max_n, uint64_t repeats) {
+  using Clock = std::chrono::steady_clock;
+  auto elapsed_ns = [](Clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::nanoseconds(Clock::now() - start).count());
+  };
+  constexpr size_t num_lookups = 100000;
+  constexpr size_t num_linear_lookups = 100;
+
+  std::vector<SortedListResult> results;
+  std::mt19937_64 gen(0x123456789);
+  for (size_t n = min_n; n <= max_n; n *= 4) {
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      const auto values = make_input("random", n, gen);
+      std::uniform_int_distribution<int> uniform(0, static_cast<int>(n) - 1);
+      std::vector<int> queries(num_lookups);
+      for (auto &x : queries) {
+        x = uniform(gen);
+      }
+
+      List plain(values.begin(), values.end());
+      plain.sort<PivotMedianOfThree>();
+      size_t found = 0;
+      auto start = Clock::now();
+      for (size_t i = 0; i < num_linear_lookups; ++i) {
+        const int query = queries[i];
+        auto pos = std::find_if(plain.begin(), plain.end(),
+                                [&](const int &val) { return val >= query; });
+        found += pos != plain.end() && *pos == query;
+      }
+      const double linear_find_ns =
+          static_cast<double>(elapsed_ns(start)) / num_linear_lookups;
+
+      start = Clock::now();
+      SortedList sorted(plain);
+      const uint64_t build_ns = elapsed_ns(start);
+
+      size_t found_sorted = 0;
+      start = Clock::now();
+      for (int query : queries) {
+        found_sorted += sorted.find(query) != sorted.end();
+      }
+      const double find_ns =
+          static_cast<double>(elapsed_ns(start)) / num_lookups;
+
+      start = Clock::now();
+      for (int query : queries) {
+        sorted.insert_sorted(query);
+      }
+      const double insert_ns =
+          static_cast<double>(elapsed_ns(start)) / num_lookups;
+
+      start = Clock::now();
+      for (int query : queries) {
+        sorted.erase(query);
+      }
+      const double erase_ns =
+          static_cast<double>(elapsed_ns(start)) / num_lookups;
+
+      // Alle Werte 0, ..., n-1 sind enthalten, jede Anfrage muss also
+      // gefunden werden.
+      if (found != num_linear_lookups || found_sorted != num_lookups ||
+          sorted.size() != n || !sorted.get_list().is_sorted()) {
+        std::cout << "Fehler in SortedList\n";
+        return 1;
+      }
+      results.push_back(
+          {n, build_ns, find_ns, linear_find_ns, insert_ns, erase_ns});
+    }
+  }
+
+  std::ofstream output;
+  output.open("sortedlist.csv");
+  output << "num_items,build_ns,find_ns_per_op,linear_find_ns_per_op,"
+            "insert_ns_per_op,erase_ns_per_op\n";
+  for (auto &x : results) {
+    output << x.num_items << "," << x.build_ns << "," << x.find_ns << ","
+           << x.linear_find_ns << "," << x.insert_ns << "," << x.erase_ns
+           << "\n";
+    if (x.num_items * 4 > max_n) {
+      std::cout << "n=" << x.num_items << " build=" << x.build_ns / 1000
+                << "us find=" << x.find_ns << "ns linear find="
+                << x.linear_find_ns << "ns insert=" << x.insert_ns
+                << "ns erase=" << x.erase_ns << "ns\n";
+    }
+  }
+
+  return 0;
+}
+
+struct MergeKResult {
+  size_t k;
+  size_t num_items;
+  std::string method;
+  uint64_t ns;
+};
+
+// Verschmilzt k sortierte Laeufe mit zusammen n Elementen zu einer Liste:
+// mit List::merge_k (Verlierer-Baum), paarweise in log2(k) Runden mit
+// List::merge und per concat mit anschliessendem sort(). Die Laeufe werden
+// per sort() erzeugt, ihre Knoten liegen also verstreut im Speicher.
+int run_merge_k_benchmark(size_t n, size_t max_k, uint64_t repeats) {
+  using Clock = std::chrono::steady_clock;
+  auto elapsed_ns = [](Clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::nanoseconds(Clock::now() - start).count());
+  };
+
+  std::vector<MergeKResult> results;
+  std::mt19937_64 gen(0x123456789);
+  for (size_t k = 2; k <= max_k; k *= 2) {
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      const auto values = make_input("random", n, gen);
+      auto make_runs = [&](const std::shared_ptr<ArenaAllocator<List::Item>>
+                               &arena) {
+        std::vector<List> runs;
+        runs.reserve(k);
+        for (size_t i = 0; i < k; ++i) {
+          runs.emplace_back(values.begin() + i * n / k,
+                            values.begin() + (i + 1) * n / k, arena);
+          runs.back().sort<PivotMedianOfThree>();
+        }
+        return runs;
+      };
+
+      for (const std::string method : {"merge_k", "pairwise", "concat+sort"}) {
+        auto arena = std::make_shared<ArenaAllocator<List::Item>>();
+        List result(arena);
+        auto runs = make_runs(arena);
+
+        const auto start = Clock::now();
+        if (method == "merge_k") {
+          result.merge_k(runs);
+        } else if (method == "pairwise") {
+          for (size_t step = 1; step < k; step *= 2) {
+            for (size_t i = 0; i + step < k; i += 2 * step) {
+              runs[i].merge(runs[i + step]);
+            }
+          }
+          result.concat(runs[0]);
+        } else {
+          for (List &run : runs) {
+            result.concat(run);
+          }
+          result.sort<PivotRandom>();
+        }
+        const uint64_t ns = elapsed_ns(start);
+
+        if (result.size() != n || !result.is_sorted()) {
+          std::cout << method << " liefert keine sortierte Liste\n";
+          return 1;
+        }
+        results.push_back({k, n, method, ns});
+      }
+    }
+  }
+
+  std::ofstream output;
+  output.open("mergek.csv");
+  output << "k,num_items,method,ns\n";
+  for (auto &x : results) {
+    output << x.k << "," << x.num_items << "," << x.method << "," << x.ns
+           << "\n";
+    if (x.k == 2 || x.k == max_k) {
+      std::cout << "k=" << x.k << " " << x.method << " " << x.ns / 1000
+                << "us\n";
+    }
+  }
+
+  return 0;
+}
+
+struct BucketResult {
+  size_t k;
+  size_t num_items;
+  std::string method;
+  uint64_t ns;
+};
+
+// Verteilt eine Liste mit n Elementen anhand von k-1 zufaelligen Splittern
+// auf k Buckets: in einem Durchlauf mit move_into_buckets (Klassifikation
+// per SplitterTree bzw. per std::upper_bound) und mit k-1 Durchlaeufen von
+// move_into_if (nur fuer k <= 64, da O(nk)).
+int run_bucket_benchmark(size_t n, size_t max_k, uint64_t repeats) {
+  using Clock = std::chrono::steady_clock;
+  auto elapsed_ns = [](Clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::nanoseconds(Clock::now() - start).count());
+  };
+
+  std::vector<BucketResult> results;
+  std::mt19937_64 gen(0x123456789);
+  for (size_t k = 2; k <= max_k; k *= 2) {
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      const auto values = make_input("random", n, gen);
+      std::vector<int> splitters;
+      std::sample(values.begin(), values.end(), std::back_inserter(splitters),
+                  k - 1, gen);
+      std::sort(splitters.begin(), splitters.end());
+      const SplitterTree<int> tree(splitters);
+      auto upper_bound = [&](const int &val) {
+        return static_cast<size_t>(
+            std::upper_bound(splitters.begin(), splitters.end(), val) -
+            splitters.begin());
+      };
+
+      for (const std::string method :
+           {"splitter-tree", "upper-bound", "move_into_if"}) {
+        if (method == "move_into_if" && k > 64) {
+          continue;
+        }
+        List list(values.begin(), values.end());
+        std::vector<List> buckets;
+        buckets.reserve(k);
+        for (size_t i = 0; i < k; ++i) {
+          buckets.emplace_back(list.get_allocator());
+        }
+
+        const auto start = Clock::now();
+        if (method == "splitter-tree") {
+          list.move_into_buckets(buckets, tree);
+        } else if (method == "upper-bound") {
+          list.move_into_buckets(buckets, upper_bound);
+        } else {
+          for (size_t i = 0; i + 1 < k && !list.empty(); ++i) {
+            list.move_into_if(buckets[i], [&](const int &val) {
+              return upper_bound(val) == i;
+            });
+          }
+          buckets[k - 1].concat(list);
+        }
+        const uint64_t ns = elapsed_ns(start);
+
+        size_t total = 0;
+        for (size_t i = 0; i < k; ++i) {
+          total += buckets[i].size();
+          if (!buckets[i].empty() &&
+              (upper_bound(*buckets[i].begin()) != i ||
+               upper_bound(buckets[i].get_last()->get_value()) != i)) {
+            std::cout << method << " verteilt falsch\n";
+            return 1;
+          }
+        }
+        if (total != n) {
+          std::cout << method << " verliert Elemente\n";
+          return 1;
+        }
+        results.push_back({k, n, method, ns});
+      }
+    }
+  }
+
+  std::ofstream output;
+  output.open("buckets.csv");
+  output << "k,num_items,method,ns\n";
+  for (auto &x : results) {
+    output << x.k << "," << x.num_items << "," << x.method << "," << x.ns
+           << "\n";
+    if (x.k == 64 || x.k == max_k) {
+      std::cout << "k=" << x.k << " " << x.method << " " << x.ns / 1000
+                << "us\n";
+    }
+  }
+
+  return 0;
+}
+
+struct SplitResult {
+  double fraction;
+  size_t num_items;
+  uint64_t ns;
+};
+
+// Misst List::move_into_if auf einer Liste mit zufaelliger Permutation von
+// 0, ..., n-1, wobei das Praedikat `val < fraction * n` den angegebenen
+// Anteil der Elemente verschiebt: 0.5 ist fuer die Sprungvorhersage der
+// schlechteste Fall, 0.01 und 0.99 sind stark einseitig.
+int run_split_benchmark(size_t n, uint64_t repeats) {
+  using Clock = std::chrono::steady_clock;
+  auto elapsed_ns = [](Clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::nanoseconds(Clock::now() - start).count());
+  };
+
+  std::vector<SplitResult> results;
+  std::mt19937_64 gen(0x123456789);
+  for (double fraction : {0.5, 0.25, 0.1, 0.01, 0.99}) {
+    const int threshold = static_cast<int>(fraction * static_cast<double>(n));
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      const auto values = make_input("random", n, gen);
+      List list(values.begin(), values.end());
+      List moved(list.get_allocator());
+
+      const auto start = Clock::now();
+      list.move_into_if(moved,
+                        [threshold](const int &val) { return val < threshold; });
+      const uint64_t ns = elapsed_ns(start);
+
+      if (moved.size() != static_cast<size_t>(threshold) ||
+          list.size() + moved.size() != n) {
+        std::cout << "move_into_if verteilt falsch\n";
+        return 1;
+      }
+      results.push_back({fraction, n, ns});
+    }
+  }
+
+  std::ofstream output;
+  output.open("split.csv");
+  output << "fraction,num_items,ns\n";
+  for (auto &x : results) {
+    output << x.fraction << "," << x.num_items << "," << x.ns << "\n";
+  }
+  for (size_t i = 0; i < results.size(); i += repeats) {
+    std::vector<uint64_t> times;
+    for (size_t j = i; j < i + repeats; ++j) {
+      times.push_back(results[j].ns);
+    }
+    std::sort(times.begin(), times.end());
+    std::cout << "fraction=" << results[i].fraction << " median "
+              << static_cast<double>(times[times.size() / 2]) / n
+              << " ns/item\n";
+  }
+
+  return 0;
+}
+
+struct NetworkResult {
+  size_t cutoff;
+  size_t num_items;
+  uint64_t comparisons;
+  uint64_t ns;
+};
+
+template <size_t NetworkCutoff>
+void measure_network_cutoff(const std::vector<int> &values,
+                            std::vector<NetworkResult> &results) {
+  using Clock = std::chrono::steady_clock;
+  List list(values.begin(), values.end());
+  const auto start = Clock::now();
+  const uint64_t comparisons =
+      list.sort<PivotMedianOfThree, Partitioning::TwoWay, NetworkCutoff>();
+  const auto ns = static_cast<uint64_t>(
+      std::chrono::nanoseconds(Clock::now() - start).count());
+  results.push_back({NetworkCutoff, values.size(), comparisons, ns});
+}
+
+// Misst List::sort (Median aus drei) mit verschiedenen Grenzen fuer den
+// Basisfall per Sortiernetzwerk; 0 heisst ohne Basisfall.
+int run_network_benchmark(size_t min_n, size_t max_n, uint64_t repeats) {
+  std::vector<NetworkResult> results;
+  std::mt19937_64 gen(0x123456789);
+  for (size_t n = min_n; n <= max_n; n *= 16) {
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      const auto values = make_input("random", n, gen);
+      measure_network_cutoff<0>(values, results);
+      measure_network_cutoff<8>(values, results);
+      measure_network_cutoff<12>(values, results);
+      measure_network_cutoff<16>(values, results);
+      measure_network_cutoff<24>(values, results);
+      measure_network_cutoff<32>(values, results);
+      measure_network_cutoff<48>(values, results);
+      measure_network_cutoff<64>(values, results);
+    }
+  }
+
+  std::ofstream output;
+  output.open("network.csv");
+  output << "cutoff,num_items,comparisons,ns\n";
+  for (auto &x : results) {
+    output << x.cutoff << "," << x.num_items << "," << x.comparisons << ","
+           << x.ns << "\n";
+    if (x.num_items * 16 > max_n) {
+      std::cout << "n=" << x.num_items << " cutoff=" << x.cutoff
+                << " comparisons=" << x.comparisons << " "
+                << x.ns / 1000 << "us\n";
+    }
+  }
+
+  return 0;
+}
+
+// Misst die Laufzeit von List::parallel_sort fuer 1, 2, 4, ... Threads
+// (bis zur Anzahl der Hardware-Threads) und schreibt die Speedup-Kurve
+// relativ zum sequentiellen sort() nach parallel.csv.
+int run_parallel_benchmark(size_t n, size_t sequential_cutoff,
+                           uint64_t repeats) {
+  using Clock = std::chrono::steady_clock;
+  std::mt19937_64 gen(0x123456789);
+  const auto values = make_input("random", n, gen);
+
+  auto time_sort = [&](auto &&sort_list) {
+    std::vector<uint64_t> times;
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      List list(values.begin(), values.end());
+      const auto start = Clock::now();
+      sort_list(list);
+      times.push_back(static_cast<uint64_t>(
+          std::chrono::nanoseconds(Clock::now() - start).count()));
       if (!list.is_sorted()) {
         std::cout << "Liste ist nicht sortiert\n";
-        return {};
+        return uint64_t{0};
       }
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+  };
+
+  // Gemessen wird ohne Instrumentierung.
+  NoSortStats no_stats;
+  const uint64_t sequential_ns = time_sort([&](List &list) {
+    PivotMedianOfThree pivot_policy;
+    list.sort_with(pivot_policy, no_stats);
+  });
 
-      results.emplace_back(n, compares);
+  std::ofstream output;
+  output.open("parallel.csv");
+  output << "threads,cutoff,num_items,time_ns,speedup\n";
+  output << 0 << "," << n << "," << n << "," << sequential_ns << ",1\n";
+
+  const size_t max_threads = ThreadPool::default_num_threads();
+  for (size_t threads = 1;; threads = std::min(2 * threads, max_threads)) {
+    ThreadPool pool(threads);
+    const uint64_t time_ns = time_sort([&](List &list) {
+      list.parallel_sort_with(pool, PivotMedianOfThree{}, no_stats,
+                              sequential_cutoff);
+    });
+    const double speedup = static_cast<double>(sequential_ns) / time_ns;
+    output << threads << "," << sequential_cutoff << "," << n << ","
+           << time_ns << "," << speedup << "\n";
+    std::cout << "threads=" << threads << " speedup=" << speedup << "\n";
+    if (threads == max_threads) {
+      break;
     }
   }
 
-  return results;
+  return 0;
+}
+
+struct MemoryResult {
+  std::string engine;
+  std::string shape;
+  size_t num_items;
+  std::string phase;
+  AllocCounters counters;
+  uint64_t num_compares;
+};
+
+// Zaehlt die Heap-Allokationen der Phasen build (Aufbau per append_range),
+// sort und destroy fuer die Sortierverfahren `engines` auf den Eingabeformen
+// `shapes` und schreibt sie zusammen mit der Anzahl der Vergleiche nach
+// memory.csv. Die Eingabe selbst wird ausserhalb der Phasen erzeugt.
+int run_memory_benchmark(const std::vector<std::string> &engines,
+                         const std::vector<std::string> &shapes, size_t min_n,
+                         size_t max_n) {
+  std::vector<MemoryResult> results;
+
+  for (const std::string &engine : engines) {
+    for (const std::string &shape : shapes) {
+      std::mt19937_64 gen(0x123456789);
+      for (size_t n = min_n; n <= max_n; n *= 2) {
+        const auto values = make_input(shape, n, gen);
+        auto list = std::make_unique<List>();
+        SortStats stats;
+
+        AllocPhase build;
+        list->append_range(values);
+        const AllocCounters build_counters = build.finish();
+
+        AllocPhase sort;
+        with_sort_engine(engine, [&](auto sort_engine) {
+          sort_engine(*list, stats);
+        });
+        const AllocCounters sort_counters = sort.finish();
+
+        if (!list->is_sorted()) {
+          std::cout << "Liste ist nicht sortiert\n";
+          return 1;
+        }
+
+        AllocPhase destroy;
+        list.reset();
+        const AllocCounters destroy_counters = destroy.finish();
+
+        results.push_back({engine, shape, n, "build", build_counters, 0});
+        results.push_back(
+            {engine, shape, n, "sort", sort_counters, stats.comparisons});
+        results.push_back({engine, shape, n, "destroy", destroy_counters, 0});
+      }
+    }
+  }
+
+  std::ofstream output;
+  output.open("memory.csv");
+  output << "engine,shape,num_items,phase,allocations,frees,allocated_bytes,"
+            "live_bytes,peak_bytes,num_compares\n";
+  for (auto &x : results) {
+    output << x.engine << "," << x.shape << "," << x.num_items << ","
+           << x.phase << "," << x.counters.allocations << ","
+           << x.counters.frees << "," << x.counters.allocated_bytes << ","
+           << x.counters.live_bytes() << "," << x.counters.peak_bytes << ","
+           << x.num_compares << "\n";
+    if (x.num_items == max_n && x.shape == shapes.front()) {
+      std::cout << x.engine << " " << x.phase << ": "
+                << x.counters.allocations << " allocs, peak "
+                << x.counters.peak_bytes / 1024 << " KiB\n";
+    }
+  }
+
+  return 0;
+}
+
+// Gibt das p-Quantil (0 <= p <= 1) der Messwerte `times` zurueck.
+uint64_t percentile(std::vector<uint64_t> times, double p) {
+  std::sort(times.begin(), times.end());
+  const auto idx = static_cast<size_t>(p * (times.size() - 1) + 0.5);
+  return times[idx];
+}
+
+// Misst die Laufzeit von List::sort (ohne Instrumentierung) im Vergleich zu
+// std::list::sort, std::forward_list::sort und std::sort auf einem
+// std::vector. Alle Verfahren sortieren pro Wiederholung dieselbe Eingabe
+// der Form `shape`; gemessen wird nur das Sortieren, nicht der Aufbau.
+// Median und 95%-Quantil der Zeit pro Element landen in times.csv.
+int run_time_benchmark(const std::string &shape, size_t min_n, size_t max_n,
+                       uint64_t repeats) {
+  using Clock = std::chrono::steady_clock;
+  const std::vector<std::string> names = {
+      "list", "list-median3", "std::list", "std::forward_list", "std::vector"};
+
+  auto time_ns = [](auto &&sort_container) {
+    const auto start = Clock::now();
+    sort_container();
+    return static_cast<uint64_t>(
+        std::chrono::nanoseconds(Clock::now() - start).count());
+  };
+
+  std::ofstream output;
+  output.open("times.csv");
+  output << "container,shape,num_items,median_ns_per_item,p95_ns_per_item\n";
+
+  std::mt19937_64 gen(0x123456789);
+  for (size_t n = min_n; n <= max_n; n *= 2) {
+    std::vector<std::vector<uint64_t>> times(names.size());
+    bool sorted = true;
+
+    for (size_t rep = 0; rep < repeats; ++rep) {
+      const auto values = make_input(shape, n, gen);
+      NoSortStats no_stats;
+
+      List list(values.begin(), values.end());
+      times[0].push_back(time_ns([&] {
+        PivotFirst pivot_policy;
+        list.sort_with(pivot_policy, no_stats);
+      }));
+      sorted = sorted && list.is_sorted();
+
+      List list_median3(values.begin(), values.end());
+      times[1].push_back(time_ns([&] {
+        PivotMedianOfThree pivot_policy;
+        list_median3.sort_with(pivot_policy, no_stats);
+      }));
+      sorted = sorted && list_median3.is_sorted();
+
+      std::list<int> std_list(values.begin(), values.end());
+      times[2].push_back(time_ns([&] { std_list.sort(); }));
+      sorted = sorted && std::is_sorted(std_list.begin(), std_list.end());
+
+      std::forward_list<int> forward_list(values.begin(), values.end());
+      times[3].push_back(time_ns([&] { forward_list.sort(); }));
+      sorted =
+          sorted && std::is_sorted(forward_list.begin(), forward_list.end());
+
+      std::vector<int> vector = values;
+      times[4].push_back(
+          time_ns([&] { std::sort(vector.begin(), vector.end()); }));
+      sorted = sorted && std::is_sorted(vector.begin(), vector.end());
+    }
+
+    if (!sorted) {
+      std::cout << "Liste ist nicht sortiert\n";
+      return 1;
+    }
+
+    for (size_t i = 0; i < names.size(); ++i) {
+      const double median = static_cast<double>(percentile(times[i], 0.5)) / n;
+      const double p95 = static_cast<double>(percentile(times[i], 0.95)) / n;
+      output << names[i] << "," << shape << "," << n << "," << median << ","
+             << p95 << "\n";
+      if (n == max_n) {
+        std::cout << names[i] << " n=" << n << " median=" << median
+                  << "ns/item p95=" << p95 << "ns/item\n";
+      }
+    }
+  }
+
+  return 0;
 }
 
-int main() {
+int main(int argc, char **argv) {
   constexpr size_t min_n = 1 << 5;
   constexpr size_t max_n = 1 << 20;
   constexpr size_t repeats = 30;
 
-  const auto results = count_number_of_compares(min_n, max_n, repeats);
+  // `./sort alloc` misst Aufbau und Abbau der Liste mit und ohne Arena sowie
+  // den Aufbau per append_range.
+  const std::string mode = argc > 1 ? argv[1] : "compares";
+  if (mode == "alloc") {
+    return run_alloc_benchmark(min_n, max_n, 5);
+  }
+
+  // Die Eingabeform (siehe workload.hpp) wird bei den meisten Modi als
+  // optionales Argument an Position `idx` uebergeben.
+  auto shapes_from_args = [&](int idx, std::vector<std::string> fallback) {
+    if (argc <= idx) {
+      return fallback;
+    }
+    if (!is_known_shape(argv[idx])) {
+      std::cerr << "Unbekannte Eingabeform: " << argv[idx] << "\n";
+      return std::vector<std::string>{};
+    }
+    return std::vector<std::string>{argv[idx]};
+  };
+  const std::vector<std::string> all_shapes(workload_shapes.begin(),
+                                            workload_shapes.end());
+
+  // `./sort pivots [shape]` vergleicht alle Pivot-Policies auf allen (oder
+  // der angegebenen) Eingabeformen.
+  if (mode == "pivots") {
+    const auto shapes = shapes_from_args(2, all_shapes);
+    if (shapes.empty()) {
+      return 1;
+    }
+    return run_engine_benchmark("pivots.csv",
+                                {"first", "random", "median3", "ninther"},
+                                shapes, min_n, max_n, 5);
+  }
+  // `./sort engines [shape]` vergleicht QuickSort (mit Zwei- und
+  // Dreiwege-Partitionierung), Mergesort und Radixsort auf denselben
+  // Eingaben.
+  if (mode == "engines") {
+    const auto shapes = shapes_from_args(2, all_shapes);
+    if (shapes.empty()) {
+      return 1;
+    }
+    return run_engine_benchmark(
+        "engines.csv", {"first", "median3", "median3-3way", "merge", "radix"},
+        shapes, min_n, max_n, 5);
+  }
+
+  // `./sort layout` vergleicht List und UnrolledList beim Durchlaufen und
+  // Sortieren.
+  if (mode == "layout") {
+    return run_layout_benchmark(min_n, max_n, 5);
+  }
+
+  // `./sort compact` vergleicht Durchlaeufe einer sortierten Liste vor und
+  // nach List::compact.
+  if (mode == "compact") {
+    return run_compact_benchmark(min_n, max_n, 5);
+  }
+
+  // `./sort prefetch` vergleicht die Durchlaeufe mit und ohne Prefetch auf
+  // Listen bis 2^25 Elementen (deutlich groesser als der Last-Level-Cache).
+  if (mode == "prefetch") {
+    return run_prefetch_benchmark(1 << 16, 1 << 25, 3);
+  }
+
+  // `./sort sortedlist` vergleicht Punktanfragen auf SortedList mit der
+  // linearen Suche in einer sortierten List.
+  if (mode == "sortedlist") {
+    return run_sorted_list_benchmark(1 << 10, max_n, 3);
+  }
+
+  // `./sort mergek` verschmilzt k = 2, ..., 1024 sortierte Laeufe mit
+  // zusammen max_n Elementen.
+  if (mode == "mergek") {
+    return run_merge_k_benchmark(max_n, 1024, 3);
+  }
+
+  // `./sort buckets` verteilt max_n Elemente auf k = 2, ..., 1024 Buckets.
+  if (mode == "buckets") {
+    return run_bucket_benchmark(max_n, 1024, 3);
+  }
+
+  // `./sort split` misst move_into_if mit ausgewogenen und einseitigen
+  // Praedikaten.
+  if (mode == "split") {
+    return run_split_benchmark(max_n, 15);
+  }
+
+  // `./sort network` vergleicht Grenzen fuer den Sortiernetzwerk-Basisfall
+  // von List::sort.
+  if (mode == "network") {
+    return run_network_benchmark(1 << 12, max_n, 5);
+  }
+
+  // `./sort parallel [cutoff]` misst den Speedup von parallel_sort ueber der
+  // Anzahl der Threads (Zeile mit threads=0: sequentielles sort()).
+  if (mode == "parallel") {
+    const size_t cutoff = argc > 2 ? std::stoul(argv[2]) : 1 << 14;
+    return run_parallel_benchmark(max_n, cutoff, 5);
+  }
+
+  // `./sort_memory memory [shape]` zaehlt Allokationen und Spitzenverbrauch
+  // beim Aufbauen, Sortieren und Abbauen der Liste.
+  if (mode == "memory") {
+    if (!alloc_tracking::enabled()) {
+      std::cerr << "Modus memory braucht die Allokationszaehlung: "
+                   "./sort_memory memory\n";
+      return 1;
+    }
+    const auto shapes = shapes_from_args(2, {"random"});
+    if (shapes.empty()) {
+      return 1;
+    }
+    return run_memory_benchmark(
+        {"first", "median3", "median3-3way", "merge", "radix"}, shapes, min_n,
+        max_n);
+  }
+
+  // `./sort time [shape]` misst die Laufzeit von List::sort gegenueber den
+  // Sortierverfahren der Standardbibliothek.
+  if (mode == "time") {
+    const auto shapes = shapes_from_args(2, {"random"});
+    if (shapes.empty()) {
+      return 1;
+    }
+    return run_time_benchmark(shapes[0], min_n, max_n, repeats);
+  }
+
+  // `./sort compares <engine> [shape] [threads]` zaehlt die Vergleiche fuer
+  // das gewaehlte Verfahren (first, random, median3, ninther, jeweils
+  // optional mit Suffix -3way, oder merge, radix) auf der gewaehlten
+  // Eingabeform (standardmaessig random). Die Wiederholungen laufen parallel
+  // auf allen (oder `threads`) Hardware-Threads; compares.csv haengt davon
+  // nicht ab.
+  const std::string engine = argc > 2 ? argv[2] : "first";
+  const auto shapes = shapes_from_args(3, {"random"});
+  if (shapes.empty()) {
+    return 1;
+  }
+  ThreadPool pool(argc > 4 ? std::stoul(argv[4])
+                           : ThreadPool::default_num_threads());
+  std::vector<std::pair<size_t, uint64_t>> results;
+  const bool known_engine = with_sort_engine(engine, [&](auto sort_engine) {
+    results = count_number_of_compares(min_n, max_n, repeats, sort_engine,
+                                       shapes[0], pool);
+  });
+  if (!known_engine) {
+    return 1;
+  }
 
   std::ofstream output;
   output.open("compares.csv");
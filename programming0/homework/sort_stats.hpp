@@ -0,0 +1,90 @@
+#ifndef SORT_STATS_HPP
+#define SORT_STATS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+/// Statistik-Policies fuer die Sortierverfahren von `BasicList`.
+///
+/// Jede Policy stellt die folgenden Methoden bereit, die waehrend des
+/// Sortierens aufgerufen werden:
+/// - `add_comparisons(k)`: `k` Vergleiche mittels `Compare`,
+/// - `add_relinks(k)`: `k` geschriebene `next`-Zeiger,
+/// - `enter_depth(d)`: ein Segment auf Partitionierungsebene `d` wird
+///   bearbeitet (die ganze Liste hat Ebene 0),
+/// - `add_partition(n, smaller)`: ein Segment mit `n` Elementen wurde
+///   partitioniert; das kleinere Teilsegment hat `smaller` Elemente,
+/// - `add_fallback()`: ein Segment wurde per Mergesort sortiert,
+/// - `merge(other)`: fasst die Statistik paralleler Tasks zusammen.
+/// `enabled` gibt an, ob die Policy ueberhaupt etwas aufzeichnet.
+
+/// Zeichnet nichts auf. Alle Methoden sind leer und werden vom Compiler
+/// entfernt, so dass ein Sortieren mit dieser Policy keine Kosten fuer die
+/// Instrumentierung hat.
+struct NoSortStats {
+  static constexpr bool enabled = false;
+
+  void add_comparisons(uint64_t) {}
+  void add_relinks(uint64_t) {}
+  void enter_depth(size_t) {}
+  void add_partition(size_t, size_t) {}
+  void add_fallback() {}
+  void merge(const NoSortStats &) {}
+};
+
+/// Zaehlt alle Ereignisse in 64-Bit-Zaehlern.
+///
+/// # Example
+/// ```c++
+/// SortStats stats;
+/// PivotMedianOfThree pivot;
+/// lst.sort_with(pivot, stats);
+/// std::cout << stats.comparisons << " " << stats.balance() << "\n";
+/// ```
+struct SortStats {
+  static constexpr bool enabled = true;
+
+  uint64_t comparisons{0};
+  uint64_t relinks{0};
+  uint64_t max_depth{0};
+  uint64_t partitions{0};
+  /// Summe der Segmentgroessen (ohne Pivot) aller Partitionierungen.
+  uint64_t partitioned_items{0};
+  /// Summe der Groessen der jeweils kleineren Teilsegmente.
+  uint64_t smaller_part_items{0};
+  uint64_t fallbacks{0};
+
+  void add_comparisons(uint64_t k) { comparisons += k; }
+  void add_relinks(uint64_t k) { relinks += k; }
+  void enter_depth(size_t depth) {
+    max_depth = std::max<uint64_t>(max_depth, depth);
+  }
+  void add_partition(size_t n, size_t smaller) {
+    ++partitions;
+    partitioned_items += n - 1;
+    smaller_part_items += smaller;
+  }
+  void add_fallback() { ++fallbacks; }
+
+  void merge(const SortStats &other) {
+    comparisons += other.comparisons;
+    relinks += other.relinks;
+    max_depth = std::max(max_depth, other.max_depth);
+    partitions += other.partitions;
+    partitioned_items += other.partitioned_items;
+    smaller_part_items += other.smaller_part_items;
+    fallbacks += other.fallbacks;
+  }
+
+  /// Mittlerer Anteil des kleineren Teilsegments, gewichtet mit der
+  /// Segmentgroesse: 0.5 bei perfekt balancierten, 0 bei maximal
+  /// unbalancierten Partitionierungen.
+  double balance() const {
+    return partitioned_items == 0
+               ? 0.5
+               : static_cast<double>(smaller_part_items) / partitioned_items;
+  }
+};
+
+#endif // SORT_STATS_HPP
@@ -0,0 +1,257 @@
+#ifndef SORTED_LIST_HPP
+#define SORTED_LIST_HPP
+
+#include "allocator.hpp"
+#include "list.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <random>
+#include <utility>
+
+/// Sortierte Liste mit Skip-List-Index. Die Elemente liegen in einer
+/// gewoehnlichen `BasicList` (Ebene 0); darueber liegen bis zu `max_levels`
+/// Expressspuren. Jedes Element erhaelt beim Einfuegen zufaellig eine
+/// Turmhoehe h (P(h >= k) = 2^-k) und ist dann in den Spuren 1, ..., h
+/// vertreten. Eine Suche laeuft in der obersten Spur los und steigt ab, sobald
+/// der naechste Eintrag nicht mehr kleiner als der gesuchte Wert ist; auf
+/// Ebene 0 bleiben so im Erwartungswert nur wenige Schritte. `find`,
+/// `lower_bound`, `insert_sorted` und `erase` brauchen damit erwartet
+/// O(log n) Vergleiche.
+///
+/// Die Spurknoten stammen aus einer eigenen Arena und verweisen ueber
+/// `const_iterator`s auf die Knoten der Liste; die Werte selbst werden nicht
+/// kopiert. Da die Spuren die Sortierung voraussetzen, gibt die Klasse nur
+/// konstanten Zugriff auf die Werte.
+///
+/// # Example
+/// ```c++
+/// List lst{5, 1, 3};
+/// lst.sort();
+/// SortedList sorted(lst); // uebernimmt die Knoten von lst in O(n)
+/// sorted.insert_sorted(4);
+/// assert(sorted.find(4) != sorted.end());
+/// sorted.erase(1);
+/// std::cout << sorted.get_list() << "\n"; // gibt "[3, 4, 5]" aus.
+/// ```
+template <typename T = int, typename Compare = std::less<T>,
+          typename Allocator = ArenaAllocator<ListItem<T>>>
+class BasicSortedList {
+public:
+  using ListType = BasicList<T, Compare, Allocator>;
+  using Value = T;
+  using const_iterator = typename ListType::const_iterator;
+
+  /// Hoechste Anzahl an Expressspuren; reicht fuer weit mehr als 2^32
+  /// Elemente.
+  static constexpr size_t max_levels = 32;
+
+  /// Erzeugt eine leere sortierte Liste.
+  BasicSortedList() : BasicSortedList(std::make_shared<Allocator>()) {}
+
+  /// Erzeugt eine leere sortierte Liste, die ihre Knoten aus `allocator`
+  /// bezieht und mit `compare` vergleicht.
+  explicit BasicSortedList(std::shared_ptr<Allocator> allocator,
+                           Compare compare = Compare{})
+      : list(std::move(allocator), std::move(compare)) {
+    init_heads();
+  }
+
+  /// Uebernimmt alle Knoten der sortierten Liste `sorted` (die danach leer
+  /// ist) und baut die Expressspuren in einem Durchlauf, also in O(n), auf.
+  explicit BasicSortedList(ListType &sorted)
+      : list(sorted.get_allocator(), sorted.get_compare()) {
+    assert(sorted.is_sorted());
+    init_heads();
+    list.concat(sorted);
+
+    std::array<Lane *, max_levels> tails;
+    for (size_t level = 0; level < max_levels; ++level) {
+      tails[level] = &heads[level];
+    }
+    for (auto pos = list.cbegin(); pos != list.cend(); ++pos) {
+      const size_t height = random_height();
+      Lane *below = nullptr;
+      for (size_t level = 0; level < height; ++level) {
+        below = new_lane(pos, nullptr, below);
+        tails[level]->next = below;
+        tails[level] = below;
+      }
+      levels = std::max(levels, height);
+    }
+  }
+
+  BasicSortedList(BasicSortedList &) = delete;
+
+  /// Entfernt alle Elemente samt Expressspuren.
+  void clear() {
+    list.clear();
+    lanes.reset();
+    init_heads();
+  }
+
+  bool empty() const { return list.empty(); }
+
+  size_t size() const { return list.size(); }
+
+  /// Die zugrundeliegende, stets sortierte Liste (Ebene 0).
+  const ListType &get_list() const { return list; }
+
+  const_iterator begin() const { return list.cbegin(); }
+  const_iterator end() const { return list.cend(); }
+
+  /// Gibt einen Iterator auf das erste Element zurueck, das nicht kleiner als
+  /// `val` ist, bzw. `end()`.
+  const_iterator lower_bound(const Value &val) const {
+    return std::next(search(val, nullptr));
+  }
+
+  /// Gibt einen Iterator auf ein Element mit Wert `val` zurueck, bzw.
+  /// `end()`, falls es keines gibt. Bei gleichen Werten ist es das erste.
+  const_iterator find(const Value &val) const {
+    const const_iterator pos = lower_bound(val);
+    return pos != end() && !less(val, *pos) ? pos : end();
+  }
+
+  /// Fuegt `val` vor allen gleichen Werten ein und gibt einen Iterator auf
+  /// das neue Element zurueck.
+  ///
+  /// # Example
+  /// ```c++
+  /// SortedList sorted;
+  /// sorted.insert_sorted(3);
+  /// sorted.insert_sorted(1);
+  /// std::cout << sorted.get_list() << "\n"; // gibt "[1, 3]" aus.
+  /// ```
+  const_iterator insert_sorted(Value val) {
+    std::array<Lane *, max_levels> update;
+    const const_iterator before = search(val, &update);
+    const const_iterator pos = list.insert_after(before, std::move(val));
+
+    const size_t height = random_height();
+    for (size_t level = levels; level < height; ++level) {
+      update[level] = &heads[level];
+    }
+    levels = std::max(levels, height);
+
+    Lane *below = nullptr;
+    for (size_t level = 0; level < height; ++level) {
+      below = new_lane(pos, update[level]->next, below);
+      update[level]->next = below;
+    }
+    return pos;
+  }
+
+  /// Entfernt das erste Element mit Wert `val`. Gibt `false` zurueck, falls
+  /// es keines gibt.
+  bool erase(const Value &val) {
+    std::array<Lane *, max_levels> update;
+    const const_iterator before = search(val, &update);
+    const const_iterator pos = std::next(before);
+    if (pos == end() || less(val, *pos)) {
+      return false;
+    }
+
+    // Der Turm von `pos` folgt in jeder Spur direkt auf `update`, denn `pos`
+    // ist das erste Element, das nicht kleiner als `val` ist.
+    for (size_t level = 0; level < levels; ++level) {
+      Lane *lane = update[level]->next;
+      if (!lane || lane->pos != pos) {
+        break;
+      }
+      update[level]->next = lane->next;
+      lanes.deallocate(lane);
+    }
+    while (levels > 0 && !heads[levels - 1].next) {
+      --levels;
+    }
+    list.erase_after(before);
+    return true;
+  }
+
+private:
+  /// Eintrag einer Expressspur: verweist auf einen Knoten der Liste, den
+  /// naechsten Eintrag derselben Spur und den Eintrag desselben Turms eine
+  /// Spur tiefer (`nullptr` in der untersten Spur).
+  struct Lane {
+    const_iterator pos;
+    Lane *next;
+    Lane *down;
+  };
+
+  ListType list;
+  ArenaAllocator<Lane> lanes;
+  /// Kopf jeder Spur; ihre `pos` ist `before_begin()` der Liste.
+  std::array<Lane, max_levels> heads;
+  /// Anzahl der belegten Spuren.
+  size_t levels{0};
+  std::mt19937_64 gen{0x5eed};
+
+  void init_heads() {
+    for (size_t level = 0; level < max_levels; ++level) {
+      heads[level] = {list.cbefore_begin(), nullptr,
+                      level > 0 ? &heads[level - 1] : nullptr};
+    }
+    levels = 0;
+  }
+
+  Lane *new_lane(const_iterator pos, Lane *next, Lane *down) {
+    return new (lanes.allocate()) Lane{pos, next, down};
+  }
+
+  size_t random_height() {
+    uint64_t bits = gen();
+    size_t height = 0;
+    while (height < max_levels && (bits & 1)) {
+      ++height;
+      bits >>= 1;
+    }
+    return height;
+  }
+
+  bool less(const Value &a, const Value &b) const {
+    return list.get_compare()(a, b);
+  }
+
+  /// Gibt den Vorgaenger des ersten Elements zurueck, das nicht kleiner als
+  /// `val` ist. Ist `update` gesetzt, landet dort fuer jede belegte Spur der
+  /// letzte Eintrag, der kleiner als `val` ist.
+  const_iterator search(const Value &val,
+                        std::array<Lane *, max_levels> *update) const {
+    if (levels == 0) {
+      return advance_while_less(list.cbefore_begin(), val);
+    }
+
+    const Lane *lane = &heads[levels - 1];
+    for (size_t level = levels; level-- > 0;) {
+      while (lane->next && less(*lane->next->pos, val)) {
+        lane = lane->next;
+      }
+      if (update) {
+        (*update)[level] = const_cast<Lane *>(lane);
+      }
+      if (level > 0) {
+        lane = lane->down;
+      }
+    }
+    return advance_while_less(lane->pos, val);
+  }
+
+  const_iterator advance_while_less(const_iterator before,
+                                    const Value &val) const {
+    for (auto pos = std::next(before); pos != end() && less(*pos, val); ++pos) {
+      before = pos;
+    }
+    return before;
+  }
+};
+
+/// Sortierte Liste von ints mit Arena-Allokator (Standard).
+using SortedList = BasicSortedList<>;
+
+#endif // SORTED_LIST_HPP
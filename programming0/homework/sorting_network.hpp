@@ -0,0 +1,112 @@
+#ifndef SORTING_NETWORK_HPP
+#define SORTING_NETWORK_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/// Sortiernetzwerke fuer kleine Eingaben, zur Compile-Zeit erzeugt.
+///
+/// Das Netzwerk fuer n Elemente ist Batchers Odd-Even-Mergesort fuer die
+/// naechste Zweierpotenz P >= n, ohne alle Komparatoren, die eine Position
+/// >= n beruehren. Das ist zulaessig, weil man sich die fehlenden Positionen
+/// mit +unendlich belegt denken kann: Ein Komparator mit einer solchen
+/// Position vertauscht nie etwas. Jeder Komparator ist ein bedingtes
+/// Vertauschen ohne Sprung (siehe `compare_exchange`); die Folge der
+/// Komparatoren ist fuer jedes n fest und wird vollstaendig ausgerollt.
+///
+/// # Example
+/// ```c++
+/// std::array<int, 5> values{4, 1, 3, 0, 2};
+/// sorting_network::sort<5>(values.data(), std::less<int>{});
+/// ```
+namespace sorting_network {
+
+/// Ein Komparator: Nach ihm ist `values[lo]` nicht groesser als
+/// `values[hi]`.
+struct Comparator {
+  uint8_t lo;
+  uint8_t hi;
+};
+
+/// Ruft `emit(lo, hi)` fuer jeden Komparator des Netzwerks fuer `n` Elemente
+/// in Ausfuehrungsreihenfolge auf.
+template <typename Emit> constexpr void generate(size_t n, Emit &&emit) {
+  size_t padded = 1;
+  while (padded < n) {
+    padded *= 2;
+  }
+  for (size_t p = 1; p < padded; p *= 2) {
+    for (size_t k = p; k >= 1; k /= 2) {
+      for (size_t j = k % p; j + k < padded; j += 2 * k) {
+        for (size_t i = 0; i < k && i + j + k < padded; ++i) {
+          if ((i + j) / (2 * p) == (i + j + k) / (2 * p) && i + j + k < n) {
+            emit(i + j, i + j + k);
+          }
+        }
+      }
+    }
+  }
+}
+
+/// Anzahl der Komparatoren des Netzwerks fuer `n` Elemente.
+constexpr size_t size(size_t n) {
+  size_t count = 0;
+  generate(n, [&count](size_t, size_t) { ++count; });
+  return count;
+}
+
+template <size_t N> constexpr std::array<Comparator, size(N)> comparators() {
+  std::array<Comparator, size(N)> result{};
+  size_t idx = 0;
+  generate(N, [&](size_t lo, size_t hi) {
+    result[idx++] = Comparator{static_cast<uint8_t>(lo),
+                               static_cast<uint8_t>(hi)};
+  });
+  return result;
+}
+
+/// Ordnet `a` und `b` per bedingter Zuweisung statt per Sprung.
+template <typename T, typename Less>
+inline void compare_exchange(T &a, T &b, const Less &less) {
+  const bool swap = less(b, a);
+  const T lo = swap ? b : a;
+  const T hi = swap ? a : b;
+  a = lo;
+  b = hi;
+}
+
+template <size_t N, typename T, typename Less, size_t... I>
+inline void apply(T *values, const Less &less, std::index_sequence<I...>) {
+  constexpr std::array<Comparator, size(N)> network = comparators<N>();
+  (compare_exchange(values[network[I].lo], values[network[I].hi], less), ...);
+}
+
+/// Sortiert `values[0], ..., values[N-1]` mit dem Netzwerk fuer N Elemente.
+/// `T` muss billig kopierbar sein (z.B. ein Zeiger auf den eigentlichen
+/// Wert).
+template <size_t N, typename T, typename Less>
+inline void sort(T *values, const Less &less) {
+  static_assert(N <= 256, "Komparatoren speichern Positionen als uint8_t");
+  apply<N>(values, less, std::make_index_sequence<size(N)>{});
+}
+
+/// Sortiert die ersten `n <= MaxN` Elemente von `values` mit dem passenden
+/// Netzwerk und gibt die Anzahl der ausgefuehrten Vergleiche zurueck.
+template <size_t MaxN, typename T, typename Less>
+inline size_t sort_up_to(T *values, size_t n, const Less &less) {
+  if constexpr (MaxN < 2) {
+    return 0;
+  } else {
+    if (n == MaxN) {
+      sorting_network::sort<MaxN>(values, less);
+      return size(MaxN);
+    }
+    return sort_up_to<MaxN - 1>(values, n, less);
+  }
+}
+
+} // namespace sorting_network
+
+#endif // SORTING_NETWORK_HPP
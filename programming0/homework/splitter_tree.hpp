@@ -0,0 +1,80 @@
+#ifndef SPLITTER_TREE_HPP
+#define SPLITTER_TREE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/// Ordnet Werte anhand von m sortierten Splittern s_0, ..., s_{m-1} einem von
+/// m + 1 Buckets zu: Bucket j enthaelt die Werte x mit s_{j-1} <= x < s_j,
+/// das Ergebnis entspricht also `std::upper_bound` ueber den Splittern.
+///
+/// Die Splitter liegen als implizit gespeicherter, vollstaendiger
+/// Suchbaum (Eytzinger-Layout, Kinder von i bei 2i und 2i+1) vor. Eine
+/// Anfrage steigt genau ceil(log2(m + 1)) Ebenen ab und berechnet den
+/// naechsten Knoten direkt aus dem Vergleichsergebnis, ohne davon
+/// abhaengigen Sprung. So fallen keine falsch vorhergesagten Spruenge an,
+/// und die oberen Ebenen liegen fuer alle Anfragen im Cache. Fehlende
+/// Blaetter werden mit dem groessten Splitter aufgefuellt; die Buckets
+/// dahinter werden auf Bucket m abgebildet.
+///
+/// # Example
+/// ```c++
+/// SplitterTree<int> classify({10, 20, 30});
+/// assert(classify.num_buckets() == 4);
+/// assert(classify(5) == 0 && classify(20) == 2 && classify(99) == 3);
+/// lst.move_into_buckets(buckets, classify);
+/// ```
+template <typename T, typename Compare = std::less<T>> class SplitterTree {
+public:
+  /// `splitters` muss bezueglich `compare` sortiert sein.
+  explicit SplitterTree(std::vector<T> splitters, Compare compare = Compare{})
+      : num_splitters{splitters.size()}, compare{std::move(compare)} {
+    assert(std::is_sorted(splitters.begin(), splitters.end(), this->compare));
+    while ((size_t{1} << levels) <= num_splitters) {
+      ++levels;
+    }
+    if (splitters.empty()) {
+      return;
+    }
+
+    splitters.resize((size_t{1} << levels) - 1, splitters.back());
+    // Index 0 bleibt unbenutzt.
+    tree.assign(splitters.size() + 1, splitters.front());
+    size_t next = 0;
+    fill(1, splitters, next);
+  }
+
+  size_t num_buckets() const { return num_splitters + 1; }
+
+  /// Gibt den Bucket von `val` zurueck.
+  size_t operator()(const T &val) const {
+    size_t node = 1;
+    for (size_t level = 0; level < levels; ++level) {
+      node = 2 * node + static_cast<size_t>(!compare(val, tree[node]));
+    }
+    return std::min(node - (size_t{1} << levels), num_splitters);
+  }
+
+private:
+  /// Anzahl der Ebenen des Baums
+  size_t levels{0};
+  size_t num_splitters;
+  std::vector<T> tree;
+  Compare compare;
+
+  /// Belegt den Teilbaum von `node` in Inorder mit den Splittern ab `next`.
+  void fill(size_t node, const std::vector<T> &splitters, size_t &next) {
+    if (node >= tree.size()) {
+      return;
+    }
+    fill(2 * node, splitters, next);
+    tree[node] = splitters[next++];
+    fill(2 * node + 1, splitters, next);
+  }
+};
+
+#endif // SPLITTER_TREE_HPP
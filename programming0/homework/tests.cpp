@@ -1,6 +1,25 @@
+#define ALLOC_TRACKING_REPLACE_NEW
+#include "alloc_tracking.hpp"
+
 #include "list.hpp"
+#include "sorted_list.hpp"
+#include "splitter_tree.hpp"
 #include "testing.hpp"
+#include "unrolled_list.hpp"
+#include "workload.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 bool test_push_front() {
   List lst;
@@ -382,6 +401,1079 @@ bool test_sorted() {
   return true;
 }
 
+bool test_arena() {
+  auto arena = std::make_shared<ArenaAllocator<List::Item>>();
+  List lst(arena);
+
+  for (int i = 0; i < 3000; ++i) {
+    lst.push_back(i);
+  }
+  const auto reserved = arena->reserved_bytes();
+
+  // Entfernte Knoten werden ueber die Freiliste wiederverwendet
+  for (int i = 0; i < 1000; ++i) {
+    lst.pop_front();
+    lst.push_back(i);
+  }
+  fail_unless_eq(arena->reserved_bytes(), reserved);
+  fail_unless_eq(lst.size(), static_cast<size_t>(3000));
+
+  // Knoten aus einer anderen Arena ueberleben deren Liste
+  {
+    List other;
+    other.push_back(-1);
+    other.push_back(-2);
+    lst.push_back_item(other.pop_front());
+    lst.concat(other);
+  }
+  fail_unless_eq(lst.size(), static_cast<size_t>(3002));
+  fail_unless_eq(lst.get_last()->get_value(), -2);
+
+  lst.clear();
+  fail_unless(lst.empty());
+  fail_unless_eq(arena->live_nodes(), static_cast<size_t>(0));
+  lst.push_back(42);
+  fail_unless_eq(lst.pop_front()->get_value(), 42);
+
+  // Ein noch gehaltenes Item verhindert das Zuruecksetzen der Arena; sonst
+  // landete sein Platz nach dem Freigeben ein zweites Mal in der Vergabe.
+  {
+    List single;
+    for (int i = 0; i < 4; ++i) {
+      single.push_back(i);
+    }
+    auto item = single.pop_front();
+    single.clear();
+    item.reset();
+    auto *a = single.push_back(100);
+    auto *b = single.push_back(200);
+    fail_unless(a != b);
+    fail_unless_eq(single.size(), static_cast<size_t>(2));
+    fail_unless_eq(single.get_last()->get_value(), 200);
+  }
+
+  return true;
+}
+
+template <typename PivotPolicy> bool sorts_with_pivot() {
+  // sortierte, umgekehrt sortierte und zufaellige Eingaben inkl. Duplikaten
+  for (int shape = 0; shape < 3; ++shape) {
+    List lst;
+    for (int i = 0; i < 500; ++i) {
+      const int val = shape == 0 ? i : shape == 1 ? 500 - i : (i * 7919) % 101;
+      lst.push_back(val);
+    }
+    lst.sort<PivotPolicy>();
+    fail_unless_eq(lst.size(), static_cast<size_t>(500));
+    fail_unless(lst.is_sorted());
+  }
+  return true;
+}
+
+bool test_sort_pivot_policies() {
+  fail_unless(sorts_with_pivot<PivotFirst>());
+  fail_unless(sorts_with_pivot<PivotRandom>());
+  fail_unless(sorts_with_pivot<PivotMedianOfThree>());
+  fail_unless(sorts_with_pivot<PivotNinther>());
+  return true;
+}
+
+bool test_sort_presorted() {
+  // Mit PivotFirst waere die Rekursionstiefe hier linear.
+  constexpr int n = 1 << 18;
+  List lst;
+  for (int i = 0; i < n; ++i) {
+    lst.push_back(i);
+  }
+  lst.sort();
+  fail_unless(lst.is_sorted());
+
+  List reversed;
+  for (int i = n; i; --i) {
+    reversed.push_back(i);
+  }
+  reversed.sort();
+  fail_unless(reversed.is_sorted());
+  fail_unless_eq(reversed.size(), static_cast<size_t>(n));
+
+  // der last-Zeiger muss nach dem Sortieren auf das Maximum zeigen
+  fail_unless_eq(reversed.get_last()->get_value(), n);
+  reversed.push_back(n + 1);
+  fail_unless(reversed.is_sorted());
+
+  return true;
+}
+
+bool test_merge_sort() {
+  List lst;
+  fail_unless_eq(lst.merge_sort(), 0u);
+
+  for (int i = 0; i < 1000; ++i) {
+    lst.push_back((i * 7919) % 257);
+  }
+  lst.merge_sort();
+  fail_unless_eq(lst.size(), static_cast<size_t>(1000));
+  fail_unless(lst.is_sorted());
+  fail_unless_eq(lst.get_last()->get_value(), 256);
+
+  // Eine sortierte Liste besteht aus einem Lauf und braucht n-1 Vergleiche
+  fail_unless_eq(lst.merge_sort(), 999u);
+
+  // Stabilitaet: gleiche Werte behalten ihre Reihenfolge
+  List stable;
+  std::vector<List::Item *> items;
+  for (int i = 0; i < 99; ++i) {
+    items.push_back(stable.push_back(i % 3));
+  }
+  stable.merge_sort();
+  for (int val = 0; val < 3; ++val) {
+    for (int i = val; i < 99; i += 3) {
+      auto popped = stable.pop_front();
+      fail_unless(popped.get() == items[i]);
+    }
+  }
+  return true;
+}
+
+bool test_unrolled_list() {
+  UnrolledList lst;
+  fail_unless(lst.empty());
+
+  for (int i = 0; i < 100; ++i) {
+    lst.push_back(i);
+    lst.push_front(-i - 1);
+  }
+  fail_unless_eq(lst.size(), static_cast<size_t>(200));
+  fail_unless(lst.is_sorted());
+  fail_unless_eq(lst.pop_front(), -100);
+
+  UnrolledList even;
+  lst.move_into_if(even, [](const int &val) { return val % 2 == 0; });
+  fail_unless_eq(lst.size() + even.size(), static_cast<size_t>(199));
+  fail_unless(lst.is_sorted());
+  fail_unless(even.is_sorted());
+
+  // ungerade absteigend + gerade -> unsortiert, dann sortieren
+  lst.concat(even);
+  fail_unless(even.empty());
+  fail_unless_eq(lst.size(), static_cast<size_t>(199));
+  fail_if(lst.is_sorted());
+
+  for (int i = 0; i < 1000; ++i) {
+    lst.push_back((i * 7919) % 257);
+  }
+  lst.sort();
+  fail_unless_eq(lst.size(), static_cast<size_t>(1199));
+  fail_unless(lst.is_sorted());
+
+  std::stringstream ss;
+  UnrolledList small;
+  small.push_back(2);
+  small.push_front(1);
+  ss << small;
+  fail_unless_eq(ss.str(), "[1, 2]");
+
+  return true;
+}
+
+struct Record {
+  uint64_t key;
+  std::unique_ptr<std::string> payload;
+};
+
+struct RecordLess {
+  bool operator()(const Record &a, const Record &b) const {
+    return a.key < b.key;
+  }
+};
+
+bool test_generic_list() {
+  BasicList<uint64_t, std::greater<uint64_t>> desc;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    desc.push_back((i * 7919) % 1009 + (uint64_t{1} << 40));
+  }
+  desc.sort<PivotMedianOfThree>();
+  fail_unless(desc.is_sorted());
+  fail_unless_eq(desc.pop_front()->get_value(), (uint64_t{1} << 40) + 1008);
+
+  // move-only Nutzlast: Sortieren haengt nur Knoten um
+  BasicList<Record, RecordLess> records;
+  for (uint64_t i = 0; i < 100; ++i) {
+    records.push_back(
+        {(i * 37) % 100, std::make_unique<std::string>(std::to_string(i))});
+  }
+  records.sort();
+  fail_unless(records.is_sorted());
+  records.merge_sort();
+  fail_unless(records.is_sorted());
+
+  auto first = records.pop_front();
+  fail_unless_eq(first->get_value().key, 0u);
+  auto payload = std::move(first->get_value().payload);
+  fail_unless_eq(*payload, "0");
+
+  BasicUnrolledList<Record, RecordLess> unrolled;
+  for (uint64_t i = 0; i < 100; ++i) {
+    unrolled.push_back(
+        {(i * 37) % 100, std::make_unique<std::string>(std::to_string(i))});
+  }
+  unrolled.sort();
+  fail_unless(unrolled.is_sorted());
+  fail_unless_eq(*unrolled.pop_front().payload, "0");
+
+  return true;
+}
+
+bool test_sort_three_way() {
+  List lst;
+  for (int i = 0; i < 10000; ++i) {
+    lst.push_back((i * 7919) % 5);
+  }
+  const auto compares =
+      lst.sort<PivotMedianOfThree, Partitioning::ThreeWay>();
+  fail_unless(lst.is_sorted());
+  fail_unless_eq(lst.size(), static_cast<size_t>(10000));
+  fail_unless_eq(lst.get_last()->get_value(), 4);
+
+  // Bei 5 verschiedenen Werten genuegen wenige Partitionierungsebenen
+  fail_unless(compares < 10 * 2 * 10000u);
+
+  List single;
+  for (int i = 0; i < 100; ++i) {
+    single.push_back(7);
+  }
+  single.sort<PivotFirst, Partitioning::ThreeWay>();
+  fail_unless(single.is_sorted());
+  fail_unless_eq(single.size(), static_cast<size_t>(100));
+  single.push_back(8);
+  fail_unless_eq(single.get_last()->get_value(), 8);
+
+  return true;
+}
+
+bool test_parallel_sort() {
+  ThreadPool pool(4);
+
+  for (size_t cutoff : {1, 16, 1 << 20}) {
+    List lst;
+    for (int i = 0; i < 20000; ++i) {
+      lst.push_back((i * 7919) % 10007);
+    }
+    lst.parallel_sort<PivotMedianOfThree>(pool, cutoff);
+    fail_unless(lst.is_sorted());
+    fail_unless_eq(lst.size(), static_cast<size_t>(20000));
+    fail_unless_eq(lst.get_last()->get_value(), 10006);
+  }
+
+  List few;
+  for (int i = 0; i < 20000; ++i) {
+    few.push_back(i % 3);
+  }
+  few.parallel_sort<PivotFirst, Partitioning::ThreeWay>(pool, 64);
+  fail_unless(few.is_sorted());
+
+  return true;
+}
+
+bool test_radix_sort() {
+  List lst;
+  for (int i = 0; i < 5000; ++i) {
+    lst.push_back((i * 7919) % 20011 - 10000);
+  }
+  lst.push_back(std::numeric_limits<int>::min());
+  lst.push_back(std::numeric_limits<int>::max());
+  lst.radix_sort();
+  fail_unless(lst.is_sorted());
+  fail_unless_eq(lst.size(), static_cast<size_t>(5002));
+  fail_unless_eq(lst.pop_front()->get_value(), std::numeric_limits<int>::min());
+  fail_unless_eq(lst.get_last()->get_value(), std::numeric_limits<int>::max());
+
+  // Nur das unterste Byte unterscheidet sich: ein einziger Durchlauf
+  List small;
+  for (int i = 255; i >= 0; --i) {
+    small.push_back(i);
+  }
+  fail_unless_eq(small.radix_sort(), 1u);
+  fail_unless(small.is_sorted());
+
+  BasicList<uint64_t> wide;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    wide.push_back((i * 0x9e3779b97f4a7c15ull) ^ (i << 60));
+  }
+  wide.radix_sort();
+  fail_unless(wide.is_sorted());
+
+  return true;
+}
+
+bool test_iterators() {
+  static_assert(std::is_same_v<std::iterator_traits<List::iterator>::iterator_category,
+                               std::forward_iterator_tag>);
+
+  List lst;
+  fail_unless(lst.begin() == lst.end());
+  for (int i = 1; i <= 5; ++i) {
+    lst.push_back(i);
+  }
+
+  int expected = 1;
+  for (int &val : lst) {
+    fail_unless_eq(val, expected++);
+    val *= 10;
+  }
+  const List &const_lst = lst;
+  fail_unless_eq(std::accumulate(const_lst.begin(), const_lst.end(), 0), 150);
+
+  List::const_iterator found = std::find_if(
+      lst.begin(), lst.end(), [](int val) { return val > 25; });
+  fail_unless(found != lst.cend());
+  fail_unless_eq(*found, 30);
+
+  // Einfuegen vorn, in der Mitte und hinter dem letzten Element
+  lst.insert_after(lst.before_begin(), 0);
+  lst.insert_after(found, 35);
+  auto last = lst.insert_after(std::next(lst.begin(), 6), 60);
+  fail_unless_eq(lst.size(), static_cast<size_t>(8));
+  fail_unless_eq(lst.get_last()->get_value(), 60);
+  fail_unless(std::next(last) == lst.end());
+
+  std::ostringstream printed;
+  printed << lst;
+  fail_unless_eq(printed.str(), std::string("[0, 10, 20, 30, 35, 40, 50, 60]"));
+
+  // Entfernen vorn und am Ende; `last` muss nachgefuehrt werden
+  auto it = lst.erase_after(lst.before_begin());
+  fail_unless_eq(*it, 10);
+  it = lst.erase_after(std::next(lst.begin(), 5));
+  fail_unless(it == lst.end());
+  fail_unless_eq(lst.get_last()->get_value(), 50);
+  lst.push_back(70);
+  fail_unless_eq(lst.size(), static_cast<size_t>(7));
+
+  while (!lst.empty()) {
+    lst.erase_after(lst.cbefore_begin());
+  }
+  fail_unless(!lst.get_last());
+  lst.push_back(1);
+  fail_unless_eq(*lst.begin(), 1);
+
+  return true;
+}
+
+bool test_bulk_construction() {
+  std::vector<int> values(3000);
+  std::iota(values.begin(), values.end(), 0);
+
+  List lst(values.begin(), values.end());
+  fail_unless_eq(lst.size(), values.size());
+  fail_unless(std::equal(lst.begin(), lst.end(), values.begin()));
+  fail_unless_eq(lst.get_last()->get_value(), 2999);
+
+  // Innerhalb eines Chunks liegen die Knoten direkt hintereinander.
+  const int *first = &*lst.begin();
+  const int *second = &*std::next(lst.begin());
+  const int *third = &*std::next(lst.begin(), 2);
+  fail_unless_eq(second - first, third - second);
+
+  List small{3, 1, 2};
+  const int tail[] = {7, 8};
+  small.append_range(tail);
+  std::istringstream input("9 10");
+  small.append_range(std::istream_iterator<int>(input),
+                     std::istream_iterator<int>());
+  small.push_back(11);
+  std::ostringstream printed;
+  printed << small;
+  fail_unless_eq(printed.str(), std::string("[3, 1, 2, 7, 8, 9, 10, 11]"));
+  fail_unless_eq(small.size(), static_cast<size_t>(8));
+
+  HeapList heap_list{1, 2, 3};
+  heap_list.append_range(values);
+  fail_unless_eq(heap_list.size(), static_cast<size_t>(3003));
+
+  std::vector<int> drained{-1};
+  lst.drain_to(drained);
+  fail_unless(lst.empty());
+  fail_unless(!lst.get_last());
+  fail_unless_eq(drained.size(), static_cast<size_t>(3001));
+  fail_unless_eq(drained.back(), 2999);
+  lst.append_range(drained);
+  fail_unless_eq(lst.size(), static_cast<size_t>(3001));
+
+  // drain_to verschiebt die Werte, auch move-only Werte
+  BasicList<std::unique_ptr<int>> owning;
+  owning.push_back(std::make_unique<int>(5));
+  std::vector<std::unique_ptr<int>> moved;
+  owning.drain_to(moved);
+  fail_unless_eq(*moved.at(0), 5);
+  fail_unless(owning.empty());
+
+  return true;
+}
+
+bool test_sort_stats() {
+  static_assert(std::is_empty_v<NoSortStats>);
+
+  std::mt19937_64 gen(42);
+  std::vector<int> values(1 << 14);
+  std::iota(values.begin(), values.end(), 0);
+  std::shuffle(values.begin(), values.end(), gen);
+
+  // Mehr als 2^16 Vergleiche duerfen nicht ueberlaufen.
+  List counted(values.begin(), values.end());
+  const uint64_t compares = counted.sort<PivotMedianOfThree>();
+  fail_unless(compares > 65535u);
+
+  List instrumented(values.begin(), values.end());
+  PivotMedianOfThree median3;
+  SortStats stats;
+  instrumented.sort_with(median3, stats);
+  fail_unless(instrumented.is_sorted());
+  fail_unless_eq(stats.comparisons, compares);
+  fail_unless(stats.relinks >= values.size());
+  fail_unless(stats.max_depth > 0u && stats.max_depth <= 2 * 14u);
+  fail_unless_eq(stats.fallbacks, 0u);
+  fail_unless(stats.balance() > 0.2 && stats.balance() <= 0.5);
+
+  // Gleiche Pivots, gleiche Partitionierungen: parallel zaehlt wie sequentiell
+  ThreadPool pool(4);
+  List parallel(values.begin(), values.end());
+  SortStats parallel_stats;
+  parallel.parallel_sort_with(pool, PivotMedianOfThree{}, parallel_stats, 256);
+  fail_unless(parallel.is_sorted());
+  fail_unless_eq(parallel_stats.comparisons, stats.comparisons);
+  fail_unless_eq(parallel_stats.partitions, stats.partitions);
+  fail_unless_eq(parallel_stats.max_depth, stats.max_depth);
+
+  // Sortierte Eingabe mit erstem Element als Pivot: maximal unbalanciert,
+  // bis auf Mergesort ausgewichen wird.
+  List presorted;
+  for (int i = 0; i < 1000; ++i) {
+    presorted.push_back(i);
+  }
+  PivotFirst first;
+  SortStats degenerate;
+  presorted.sort_with(first, degenerate);
+  fail_unless(presorted.is_sorted());
+  fail_unless_eq(degenerate.balance(), 0.0);
+  fail_unless_eq(degenerate.fallbacks, 1u);
+  fail_unless_eq(degenerate.max_depth, 2 * 9u);
+
+  NoSortStats none;
+  List plain(values.begin(), values.end());
+  plain.sort_with<Partitioning::ThreeWay>(first, none);
+  fail_unless(plain.is_sorted());
+
+  List merged(values.begin(), values.end());
+  SortStats merge_stats;
+  merged.merge_sort(merge_stats);
+  fail_unless(merged.is_sorted());
+  fail_unless(merge_stats.comparisons > 0u);
+  fail_unless(merge_stats.relinks >= values.size());
+
+  return true;
+}
+
+bool test_workload_shapes() {
+  constexpr size_t n = 5000;
+  for (const std::string shape : workload_shapes) {
+    std::mt19937_64 gen(7);
+    std::mt19937_64 same_seed(7);
+    const auto values = make_input(shape, n, gen);
+    fail_unless_eq(values.size(), n);
+    fail_unless(values == make_input(shape, n, same_seed));
+    fail_unless(std::all_of(values.begin(), values.end(), [](int val) {
+      return val >= 0 && val < static_cast<int>(n);
+    }));
+
+    // Jede Eingabeform muss von allen Verfahren korrekt sortiert werden.
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    List quick(values.begin(), values.end());
+    quick.sort<PivotNinther, Partitioning::ThreeWay>();
+    List merged(values.begin(), values.end());
+    merged.merge_sort();
+    List radix(values.begin(), values.end());
+    radix.radix_sort();
+    fail_unless_msg(std::equal(quick.begin(), quick.end(), expected.begin()),
+                    shape);
+    fail_unless_msg(std::equal(merged.begin(), merged.end(), expected.begin()),
+                    shape);
+    fail_unless_msg(std::equal(radix.begin(), radix.end(), expected.begin()),
+                    shape);
+  }
+
+  std::mt19937_64 gen(7);
+  const auto k_sorted = make_input("k-sorted", n, gen);
+  for (size_t i = 0; i < n; ++i) {
+    fail_unless(std::abs(k_sorted[i] - static_cast<int>(i)) < 16);
+  }
+  const auto few = make_input("few-uniques", n, gen);
+  fail_unless(*std::max_element(few.begin(), few.end()) < 16);
+  const auto zipf = make_input("zipf", n, gen);
+  fail_unless(std::count(zipf.begin(), zipf.end(), 0) > static_cast<long>(n / 20));
+  fail_unless(!is_known_shape("unknown"));
+
+  return true;
+}
+
+bool test_alloc_tracking() {
+  fail_unless(alloc_tracking::enabled());
+  std::vector<int> values(4096);
+  std::iota(values.begin(), values.end(), 0);
+  std::reverse(values.begin(), values.end());
+
+  // Arena: eine Allokation pro Chunk (plus Wachstum der Chunk-Verwaltung)
+  auto list = std::make_unique<List>();
+  AllocPhase build;
+  list->append_range(values);
+  const AllocCounters build_counters = build.finish();
+  fail_unless(build_counters.allocations >= 4u);
+  fail_unless(build_counters.allocations < 16u);
+  fail_unless(build_counters.peak_bytes >= 4096 * sizeof(List::Item));
+
+  // Sortieren haengt nur um und darf nie allozieren.
+  AllocPhase sort;
+  list->sort<PivotNinther>();
+  list->sort<PivotMedianOfThree, Partitioning::ThreeWay>();
+  list->merge_sort();
+  list->radix_sort();
+  const AllocCounters sort_counters = sort.finish();
+  fail_unless_eq(sort_counters.allocations, 0u);
+  fail_unless_eq(sort_counters.frees, 0u);
+
+  AllocPhase destroy;
+  list.reset();
+  const AllocCounters destroy_counters = destroy.finish();
+  fail_unless_eq(destroy_counters.allocations, 0u);
+  // Freigegeben werden die Chunks sowie die Liste und ihre Arena selbst.
+  fail_unless(destroy_counters.live_bytes() < -build_counters.live_bytes());
+
+  // Heap: genau eine Allokation pro Element
+  AllocPhase heap_phase;
+  {
+    HeapList heap_list(values.begin(), values.end());
+    heap_list.pop_front();
+    fail_unless_eq(heap_phase.finish().allocations, 4096u + 1);
+  }
+  const AllocCounters heap_counters = heap_phase.finish();
+  fail_unless_eq(heap_counters.frees, heap_counters.allocations);
+  fail_unless_eq(heap_counters.live_bytes(), 0);
+
+  return true;
+}
+
+bool test_compact() {
+  std::mt19937_64 gen(3);
+  const auto values = make_input("random", 3000, gen);
+
+  List lst(values.begin(), values.end());
+  List other(lst.get_allocator());
+  other.push_back(-1);
+  auto popped = lst.pop_front();
+  lst.sort();
+  lst.compact();
+
+  fail_unless(lst.is_sorted());
+  fail_unless_eq(lst.size(), values.size() - 1);
+  fail_unless_eq(lst.get_last()->get_value(), 2999);
+  // Nach dem Umordnen liegen die Knoten an aufsteigenden Adressen.
+  const int *prev = nullptr;
+  for (const int &val : lst) {
+    fail_unless(!prev || std::less<const int *>{}(prev, &val));
+    prev = &val;
+  }
+  // Geteilte Arena und herausgegebene Items bleiben unberuehrt.
+  fail_unless_eq(other.get_last()->get_value(), -1);
+  fail_unless_eq(popped->get_value(), values.front());
+  lst.push_back(5000);
+  fail_unless_eq(lst.size(), values.size());
+
+  // Automatisch nach dem Sortieren ab einer Mindestgroesse
+  HeapList heap(values.begin(), values.end());
+  heap.compact_after_sort(1000);
+  heap.merge_sort();
+  fail_unless(heap.is_sorted());
+  prev = nullptr;
+  for (const int &val : heap) {
+    fail_unless(!prev || std::less<const int *>{}(prev, &val));
+    prev = &val;
+  }
+
+  BasicList<std::unique_ptr<int>, std::function<bool(const std::unique_ptr<int> &,
+                                                     const std::unique_ptr<int> &)>>
+      owning(std::make_shared<ArenaAllocator<ListItem<std::unique_ptr<int>>>>(),
+             [](const auto &a, const auto &b) { return *a < *b; });
+  for (int i = 0; i < 100; ++i) {
+    owning.push_back(std::make_unique<int>((i * 37) % 100));
+  }
+  owning.compact_after_sort(1);
+  owning.sort<PivotMedianOfThree>();
+  int expected = 0;
+  for (const auto &val : owning) {
+    fail_unless_eq(*val, expected++);
+  }
+
+  return true;
+}
+
+bool test_prefetch_traversal() {
+  std::mt19937_64 gen(4);
+  const auto values = make_input("random", 1000, gen);
+
+  List lst(values.begin(), values.end());
+  lst.sort();
+  PrefetchHints hints;
+  std::vector<int> plain, prefetched;
+  lst.foreach ([&](int val) { plain.push_back(val); });
+  lst.foreach(hints, [&](int val) { prefetched.push_back(val); });
+  fail_unless(plain == prefetched);
+  fail_unless(lst.is_sorted(hints));
+
+  // Veraltete Hinweise nach Aenderungen der Liste aendern nichts am Ergebnis.
+  lst.push_front(2000);
+  lst.erase_after(std::next(lst.before_begin(), 500));
+  fail_unless(!lst.is_sorted(hints));
+  lst.pop_front();
+  fail_unless(lst.is_sorted(hints));
+
+  List even(lst.get_allocator());
+  lst.move_into_if(hints, even, [](int val) { return val % 2 == 0; });
+  fail_unless_eq(lst.size() + even.size(), values.size() - 1);
+  fail_unless(lst.is_sorted(hints));
+  fail_unless(even.is_sorted(hints));
+  size_t num_even = 0;
+  lst.foreach(hints, [&](int val) { num_even += val % 2 == 0; });
+  fail_unless_eq(num_even, size_t{0});
+
+  // Konstante Durchlaeufe mit eigenen Hinweisen pro Thread aendern die Liste
+  // nicht und duerfen daher gleichzeitig laufen.
+  const List &shared = lst;
+  std::array<int64_t, 2> sums{0, 0};
+  std::vector<std::thread> readers;
+  for (size_t t = 0; t < sums.size(); ++t) {
+    readers.emplace_back([&shared, &sums, t] {
+      PrefetchHints own;
+      for (int rep = 0; rep < 3; ++rep) {
+        sums[t] = 0;
+        shared.foreach(own, [&](int val) { sums[t] += val; });
+        sums[t] += shared.is_sorted(own) ? 0 : 1;
+      }
+    });
+  }
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  int64_t expected_sum = 0;
+  lst.foreach ([&](int val) { expected_sum += val; });
+  fail_unless_eq(sums[0], expected_sum);
+  fail_unless_eq(sums[1], expected_sum);
+
+  List empty;
+  fail_unless(empty.is_sorted(hints));
+  empty.foreach(hints, [](int) { std::abort(); });
+
+  return true;
+}
+
+bool test_sorted_list() {
+  std::mt19937_64 gen(5);
+  const auto values = make_input("random-dup", 2000, gen);
+
+  List lst(values.begin(), values.end());
+  lst.sort();
+  SortedList sorted(lst);
+  fail_unless(lst.empty());
+  fail_unless_eq(sorted.size(), values.size());
+
+  std::vector<int> expected = values;
+  std::sort(expected.begin(), expected.end());
+  for (int val = -1; val <= 2000; ++val) {
+    const auto pos = sorted.lower_bound(val);
+    const auto it = std::lower_bound(expected.begin(), expected.end(), val);
+    fail_unless_eq(pos == sorted.end(), it == expected.end());
+    if (it != expected.end()) {
+      fail_unless_eq(*pos, *it);
+    }
+    const bool contained = std::binary_search(expected.begin(), expected.end(), val);
+    fail_unless_eq(sorted.find(val) != sorted.end(), contained);
+  }
+
+  // Abwechselnd einfuegen und entfernen
+  std::uniform_int_distribution<int> uniform(-100, 2100);
+  for (int i = 0; i < 3000; ++i) {
+    const int val = uniform(gen);
+    if (i % 3 == 2) {
+      const auto it = std::lower_bound(expected.begin(), expected.end(), val);
+      const bool contained = it != expected.end() && *it == val;
+      fail_unless_eq(sorted.erase(val), contained);
+      if (contained) {
+        expected.erase(it);
+      }
+    } else {
+      fail_unless_eq(*sorted.insert_sorted(val), val);
+      expected.insert(std::upper_bound(expected.begin(), expected.end(), val),
+                      val);
+    }
+  }
+  fail_unless(sorted.get_list().is_sorted());
+  fail_unless(std::equal(sorted.begin(), sorted.end(), expected.begin(),
+                         expected.end()));
+
+  // Alles entfernen, danach wieder aufbauen
+  for (int val : expected) {
+    fail_unless(sorted.erase(val));
+  }
+  fail_unless(sorted.empty());
+  fail_unless(sorted.find(0) == sorted.end());
+  sorted.insert_sorted(2);
+  sorted.insert_sorted(1);
+  sorted.insert_sorted(2);
+  fail_unless_eq(sorted.size(), size_t{3});
+  fail_unless_eq(*sorted.begin(), 1);
+  sorted.clear();
+  fail_unless(sorted.empty());
+  sorted.insert_sorted(7);
+  fail_unless_eq(*sorted.find(7), 7);
+
+  // Eigener Vergleicher: absteigend sortiert
+  BasicSortedList<int, std::greater<int>> descending;
+  for (int val : {3, 9, 1, 5}) {
+    descending.insert_sorted(val);
+  }
+  fail_unless_eq(*descending.begin(), 9);
+  fail_unless_eq(*descending.lower_bound(4), 3);
+
+  return true;
+}
+
+bool test_merge_and_set_operations() {
+  std::mt19937_64 gen(6);
+  const auto a_values = make_input("random-dup", 500, gen);
+  const auto b_values = make_input("few-uniques", 300, gen);
+  std::vector<int> a_sorted = a_values, b_sorted = b_values;
+  std::sort(a_sorted.begin(), a_sorted.end());
+  std::sort(b_sorted.begin(), b_sorted.end());
+
+  auto make_sorted = [](const std::vector<int> &values,
+                        std::shared_ptr<ArenaAllocator<List::Item>> arena) {
+    auto lst = std::make_unique<List>(values.begin(), values.end(),
+                                      std::move(arena));
+    lst->sort();
+    return lst;
+  };
+  auto matches = [](const List &lst, const std::vector<int> &expected) {
+    return lst.size() == expected.size() && lst.is_sorted() &&
+           std::equal(lst.begin(), lst.end(), expected.begin(),
+                      expected.end()) &&
+           (lst.empty() ? !lst.get_last()
+                        : lst.get_last()->get_value() == expected.back());
+  };
+
+  // Jede Operation einmal mit getrennten und einmal mit gemeinsamer Arena
+  for (bool shared : {false, true}) {
+    auto arena = std::make_shared<ArenaAllocator<List::Item>>();
+    auto a_arena = shared ? arena : std::make_shared<ArenaAllocator<List::Item>>();
+    auto b_arena = shared ? arena : std::make_shared<ArenaAllocator<List::Item>>();
+    std::vector<int> expected;
+
+    auto a = make_sorted(a_values, a_arena);
+    auto b = make_sorted(b_values, b_arena);
+    std::merge(a_sorted.begin(), a_sorted.end(), b_sorted.begin(),
+               b_sorted.end(), std::back_inserter(expected));
+    a->merge(*b);
+    fail_unless(matches(*a, expected));
+    fail_unless(b->empty());
+    b->push_back(1);
+    fail_unless_eq(b->get_last()->get_value(), 1);
+
+    a = make_sorted(a_values, a_arena);
+    b = make_sorted(b_values, b_arena);
+    expected.clear();
+    std::set_union(a_sorted.begin(), a_sorted.end(), b_sorted.begin(),
+                   b_sorted.end(), std::back_inserter(expected));
+    a->set_union(*b);
+    fail_unless(matches(*a, expected));
+    fail_unless(b->empty());
+
+    a = make_sorted(a_values, a_arena);
+    b = make_sorted(b_values, b_arena);
+    expected.clear();
+    std::set_intersection(a_sorted.begin(), a_sorted.end(), b_sorted.begin(),
+                          b_sorted.end(), std::back_inserter(expected));
+    a->set_intersection(*b);
+    fail_unless(matches(*a, expected));
+    fail_unless(matches(*b, b_sorted));
+
+    a = make_sorted(a_values, a_arena);
+    b = make_sorted(b_values, b_arena);
+    expected.clear();
+    std::set_difference(a_sorted.begin(), a_sorted.end(), b_sorted.begin(),
+                        b_sorted.end(), std::back_inserter(expected));
+    a->set_difference(*b);
+    fail_unless(matches(*a, expected));
+    fail_unless(matches(*b, b_sorted));
+  }
+
+  // Randfaelle mit leeren Listen und Ueberhang auf beiden Seiten
+  List empty, one{1}, tail{0, 2, 3};
+  one.set_union(tail);
+  fail_unless(matches(one, {0, 1, 2, 3}));
+  empty.set_union(one);
+  fail_unless(matches(empty, {0, 1, 2, 3}));
+  List low{0, 1};
+  empty.set_difference(low);
+  fail_unless(matches(empty, {2, 3}));
+  List none;
+  empty.set_intersection(none);
+  fail_unless(matches(empty, {}));
+
+  // merge ist stabil: Gleiche Schluessel aus dieser Liste kommen zuerst.
+  using Pair = std::pair<int, int>;
+  auto by_first = [](const Pair &x, const Pair &y) { return x.first < y.first; };
+  using PairList = BasicList<Pair, decltype(by_first)>;
+  auto pair_arena = std::make_shared<ArenaAllocator<ListItem<Pair>>>();
+  PairList left({{1, 0}, {2, 0}, {2, 1}}, pair_arena, by_first);
+  PairList right({{2, 2}, {3, 0}}, pair_arena, by_first);
+  left.merge(right);
+  const std::vector<Pair> stable{{1, 0}, {2, 0}, {2, 1}, {2, 2}, {3, 0}};
+  fail_unless(std::equal(left.begin(), left.end(), stable.begin(), stable.end()));
+
+  return true;
+}
+
+bool test_merge_k() {
+  std::mt19937_64 gen(7);
+  for (size_t k : {0, 1, 2, 3, 7, 64}) {
+    auto arena = std::make_shared<ArenaAllocator<List::Item>>();
+    std::vector<int> expected;
+    List lst(arena);
+    std::vector<List> runs;
+    for (size_t i = 0; i < k; ++i) {
+      // Teilweise leere Eingaben und eigene Arenen
+      const auto values = make_input("random-dup", i % 4 == 1 ? 0 : 50 + i, gen);
+      runs.emplace_back(values.begin(), values.end(),
+                        i % 2 ? arena
+                              : std::make_shared<ArenaAllocator<List::Item>>());
+      runs.back().sort();
+      expected.insert(expected.end(), values.begin(), values.end());
+    }
+    lst.merge_k(runs);
+    std::sort(expected.begin(), expected.end());
+
+    fail_unless_eq(lst.size(), expected.size());
+    fail_unless(std::equal(lst.begin(), lst.end(), expected.begin(),
+                           expected.end()));
+    for (const List &run : runs) {
+      fail_unless(run.empty());
+    }
+    lst.push_back(1000);
+    fail_unless_eq(lst.get_last()->get_value(), 1000);
+  }
+
+  // Nur diese Liste ist nicht leer: `last` bleibt erhalten.
+  {
+    List lst{1, 2, 3};
+    std::vector<List> empty_runs(3);
+    lst.merge_k(empty_runs);
+    lst.push_back(4);
+    fail_unless_eq(lst.size(), size_t{4});
+    fail_unless_eq(lst.get_last()->get_value(), 4);
+  }
+
+  // Stabil: bei gleichen Schluesseln zuerst diese Liste, dann `others` in
+  // ihrer Reihenfolge.
+  using Pair = std::pair<int, int>;
+  auto by_first = [](const Pair &x, const Pair &y) { return x.first < y.first; };
+  using PairList = BasicList<Pair, decltype(by_first)>;
+  auto pair_arena = std::make_shared<ArenaAllocator<ListItem<Pair>>>();
+  PairList first({{1, 0}, {2, 0}}, pair_arena, by_first);
+  std::vector<PairList> others;
+  others.emplace_back(std::initializer_list<Pair>{{0, 1}, {2, 1}}, pair_arena,
+                      by_first);
+  others.emplace_back(std::initializer_list<Pair>{{1, 2}, {2, 2}, {3, 2}},
+                      pair_arena, by_first);
+  first.merge_k(others);
+  const std::vector<Pair> stable{{0, 1}, {1, 0}, {1, 2}, {2, 0},
+                                 {2, 1}, {2, 2}, {3, 2}};
+  fail_unless(std::equal(first.begin(), first.end(), stable.begin(),
+                         stable.end()));
+
+  // Verschobene Listen bleiben gueltig und benutzbar.
+  List source{3, 4};
+  List moved(std::move(source));
+  fail_unless(source.empty());
+  source.push_back(5);
+  moved.push_back(6);
+  fail_unless_eq(moved.size(), size_t{3});
+  fail_unless_eq(moved.get_last()->get_value(), 6);
+  fail_unless_eq(source.get_last()->get_value(), 5);
+  List from_empty(std::move(List()));
+  from_empty.push_back(1);
+  fail_unless_eq(from_empty.get_last()->get_value(), 1);
+
+  return true;
+}
+
+bool test_move_into_buckets() {
+  std::mt19937_64 gen(8);
+  const auto values = make_input("random-dup", 3000, gen);
+
+  // Stabil, vorhandene Elemente bleiben vorne, auch mit fremder Arena
+  List lst(values.begin(), values.end());
+  std::vector<List> buckets(5);
+  buckets[2].push_back(-1);
+  lst.move_into_buckets(buckets, [](int val) { return size_t(val % 5); });
+  fail_unless(lst.empty());
+  lst.push_back(7);
+  fail_unless_eq(lst.get_last()->get_value(), 7);
+  size_t total = 0;
+  for (size_t b = 0; b < buckets.size(); ++b) {
+    std::vector<int> expected = b == 2 ? std::vector<int>{-1} : std::vector<int>{};
+    std::copy_if(values.begin(), values.end(), std::back_inserter(expected),
+                 [&](int val) { return size_t(val % 5) == b; });
+    fail_unless(std::equal(buckets[b].begin(), buckets[b].end(),
+                           expected.begin(), expected.end()));
+    fail_unless_eq(buckets[b].size(), expected.size());
+    fail_unless_eq(buckets[b].get_last()->get_value(), expected.back());
+    total += buckets[b].size();
+  }
+  fail_unless_eq(total, values.size() + 1);
+
+  // SplitterTree entspricht std::upper_bound, fuer jede Splitteranzahl
+  for (size_t m : {0, 1, 2, 3, 6, 7, 8, 100}) {
+    std::vector<int> splitters;
+    std::sample(values.begin(), values.end(), std::back_inserter(splitters), m,
+                gen);
+    std::sort(splitters.begin(), splitters.end());
+    SplitterTree<int> classify(splitters);
+    fail_unless_eq(classify.num_buckets(), splitters.size() + 1);
+    for (int val = -2; val < 3002; ++val) {
+      const size_t expected =
+          std::upper_bound(splitters.begin(), splitters.end(), val) -
+          splitters.begin();
+      fail_unless_eq(classify(val), expected);
+    }
+  }
+
+  // Als Verteilungsschritt: sortierte Buckets aneinandergehaengt ergeben die
+  // sortierte Liste.
+  List input(values.begin(), values.end());
+  SplitterTree<int> classify({500, 1000, 1000, 2500});
+  std::array<List, 5> ranges;
+  input.move_into_buckets(ranges, classify);
+  fail_unless(ranges[2].empty());
+  for (List &range : ranges) {
+    range.sort();
+    input.concat(range);
+  }
+  fail_unless(input.is_sorted());
+  fail_unless_eq(input.size(), values.size());
+
+  return true;
+}
+
+bool test_move_into_if_tails() {
+  // Alle, keine und jedes zweite Element verschieben; das Ziel ist nicht leer.
+  for (int modulus : {1, 2, 1000}) {
+    List lst{0, 1, 2, 3, 4, 5, 6, 7};
+    List target{-1};
+    lst.move_into_if(target, [&](int val) { return val % modulus == 0; });
+
+    std::vector<int> kept, moved{-1};
+    for (int val = 0; val < 8; ++val) {
+      (val % modulus == 0 ? moved : kept).push_back(val);
+    }
+    fail_unless_eq(lst.size(), kept.size());
+    fail_unless_eq(target.size(), moved.size());
+    fail_unless(std::equal(lst.begin(), lst.end(), kept.begin(), kept.end()));
+    fail_unless(
+        std::equal(target.begin(), target.end(), moved.begin(), moved.end()));
+
+    // Die Enden beider Listen sind korrekt gesetzt.
+    lst.push_back(100);
+    target.push_back(200);
+    fail_unless_eq(lst.get_last()->get_value(), 100);
+    fail_unless_eq(target.get_last()->get_value(), 200);
+    fail_unless_eq(lst.size(), kept.size() + 1);
+    fail_unless_eq(*std::next(target.begin(), moved.size()), 200);
+  }
+  return true;
+}
+
+template <size_t NetworkCutoff> bool check_network_cutoff() {
+  std::mt19937_64 gen(NetworkCutoff);
+  for (const char *shape : {"random", "random-dup", "few-uniques", "sorted"}) {
+    const auto values = make_input(shape, 5000, gen);
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    List two_way(values.begin(), values.end());
+    two_way.sort<PivotMedianOfThree, Partitioning::TwoWay, NetworkCutoff>();
+    fail_unless(std::equal(two_way.begin(), two_way.end(), expected.begin(),
+                           expected.end()));
+    fail_unless_eq(two_way.get_last()->get_value(), expected.back());
+
+    List three_way(values.begin(), values.end());
+    three_way.sort<PivotFirst, Partitioning::ThreeWay, NetworkCutoff>();
+    fail_unless(std::equal(three_way.begin(), three_way.end(),
+                           expected.begin(), expected.end()));
+
+    ThreadPool pool(2);
+    List parallel(values.begin(), values.end());
+    parallel.parallel_sort<PivotRandom, Partitioning::TwoWay, NetworkCutoff>(
+        pool, 256);
+    fail_unless(std::equal(parallel.begin(), parallel.end(), expected.begin(),
+                           expected.end()));
+  }
+  return true;
+}
+
+bool test_sort_network() {
+  // 0-1-Prinzip: Ein Netzwerk sortiert alles, wenn es alle 0-1-Folgen
+  // sortiert.
+  auto check_all_bit_patterns = [](auto size) {
+    constexpr size_t n = decltype(size)::value;
+    for (uint32_t bits = 0; bits < (uint32_t{1} << n); ++bits) {
+      std::array<int, n> values;
+      for (size_t i = 0; i < n; ++i) {
+        values[i] = (bits >> i) & 1;
+      }
+      sorting_network::sort<n>(values.data(), std::less<int>{});
+      if (!std::is_sorted(values.begin(), values.end())) {
+        return false;
+      }
+    }
+    return true;
+  };
+  fail_unless(check_all_bit_patterns(std::integral_constant<size_t, 2>{}));
+  fail_unless(check_all_bit_patterns(std::integral_constant<size_t, 5>{}));
+  fail_unless(check_all_bit_patterns(std::integral_constant<size_t, 11>{}));
+  fail_unless(check_all_bit_patterns(std::integral_constant<size_t, 16>{}));
+  fail_unless(check_all_bit_patterns(std::integral_constant<size_t, 19>{}));
+  fail_unless_eq(sorting_network::size(16), size_t{63});
+
+  fail_unless(check_network_cutoff<0>());
+  fail_unless(check_network_cutoff<2>());
+  fail_unless(check_network_cutoff<16>());
+  fail_unless(check_network_cutoff<33>());
+  fail_unless(check_network_cutoff<64>());
+
+  // Die Werte bleiben in ihren Knoten; nur die Verkettung aendert sich.
+  List lst;
+  std::vector<std::pair<int, const List::Item *>> items;
+  for (int val : {5, 3, 9, 1, 7, 2}) {
+    items.emplace_back(val, lst.push_back(val));
+  }
+  lst.sort();
+  for (auto &[val, item] : items) {
+    fail_unless_eq(item->get_value(), val);
+  }
+  fail_unless(lst.is_sorted());
+
+  return true;
+}
+
 int main() {
   run_test(test_push_front);
   run_test(test_foreach);
@@ -396,6 +1488,28 @@ int main() {
   run_test(test_concat_last_update);
   run_test(test_moveinto);
   run_test(test_sorted);
+  run_test(test_arena);
+  run_test(test_sort_pivot_policies);
+  run_test(test_sort_presorted);
+  run_test(test_merge_sort);
+  run_test(test_unrolled_list);
+  run_test(test_generic_list);
+  run_test(test_sort_three_way);
+  run_test(test_parallel_sort);
+  run_test(test_radix_sort);
+  run_test(test_iterators);
+  run_test(test_bulk_construction);
+  run_test(test_sort_stats);
+  run_test(test_workload_shapes);
+  run_test(test_alloc_tracking);
+  run_test(test_compact);
+  run_test(test_prefetch_traversal);
+  run_test(test_sorted_list);
+  run_test(test_merge_and_set_operations);
+  run_test(test_merge_k);
+  run_test(test_move_into_buckets);
+  run_test(test_move_into_if_tails);
+  run_test(test_sort_network);
 
   return 0;
 }
@@ -0,0 +1,198 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Einfacher Thread-Pool mit Work-Stealing.
+///
+/// Jeder Thread besitzt eine eigene Warteschlange. Neue Tasks landen in der
+/// Schlange des erzeugenden Threads und werden dort in LIFO-Reihenfolge
+/// abgearbeitet (gut fuer die Cache-Lokalitaet rekursiver Zerlegungen).
+/// Hat ein Thread nichts mehr zu tun, stiehlt er die aeltesten Tasks aus den
+/// Schlangen der anderen Threads. Der Thread, der auf eine `TaskGroup`
+/// wartet, arbeitet dabei selbst mit; ein Pool mit `num_threads == 1` startet
+/// daher keinen zusaetzlichen Thread.
+class ThreadPool {
+public:
+  using Task = std::function<void()>;
+
+  explicit ThreadPool(size_t num_threads = default_num_threads())
+      : queues(std::max<size_t>(num_threads, 1)) {
+    for (auto &queue : queues) {
+      queue = std::make_unique<Queue>();
+    }
+    // Schlange 0 gehoert allen Threads, die nicht zum Pool gehoeren.
+    for (size_t idx = 1; idx < queues.size(); ++idx) {
+      workers.emplace_back([this, idx] { worker_loop(idx); });
+    }
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex);
+      stop = true;
+    }
+    wake_up.notify_all();
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  static size_t default_num_threads() {
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  }
+
+  /// Anzahl der Threads inklusive des wartenden Aufrufers.
+  size_t size() const { return queues.size(); }
+
+  /// Reiht `task` in die Schlange des aktuellen Threads ein.
+  void submit(Task task) {
+    Queue &queue = *queues[own_queue_index()];
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.push_back(std::move(task));
+    }
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex);
+      ++num_queued;
+    }
+    wake_up.notify_one();
+  }
+
+  /// Fuehrt hoechstens einen Task aus (zuerst aus der eigenen Schlange, dann
+  /// gestohlen). Gibt `false` zurueck, falls keiner verfuegbar war.
+  bool run_one() {
+    const size_t own = own_queue_index();
+    Task task;
+    if (!pop_back(own, task)) {
+      bool stolen = false;
+      for (size_t i = 1; i < queues.size() && !stolen; ++i) {
+        stolen = pop_front((own + i) % queues.size(), task);
+      }
+      if (!stolen) {
+        return false;
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex);
+      --num_queued;
+    }
+    task();
+    return true;
+  }
+
+private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<Queue>> queues;
+  std::vector<std::thread> workers;
+
+  std::mutex sleep_mutex;
+  std::condition_variable wake_up;
+  size_t num_queued{0};
+  bool stop{false};
+
+  // Index der eigenen Schlange des aktuellen Threads in diesem Pool.
+  static inline thread_local const ThreadPool *current_pool = nullptr;
+  static inline thread_local size_t current_index = 0;
+
+  size_t own_queue_index() const {
+    return current_pool == this ? current_index : 0;
+  }
+
+  bool pop_back(size_t idx, Task &task) {
+    Queue &queue = *queues[idx];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+  }
+
+  bool pop_front(size_t idx, Task &task) {
+    Queue &queue = *queues[idx];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      return false;
+    }
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    return true;
+  }
+
+  void worker_loop(size_t idx) {
+    current_pool = this;
+    current_index = idx;
+    while (true) {
+      if (run_one()) {
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex);
+      wake_up.wait(lock, [this] { return stop || num_queued > 0; });
+      if (stop) {
+        return;
+      }
+    }
+  }
+};
+
+/// Menge von Tasks, auf deren Ende gemeinsam gewartet werden kann. Tasks
+/// duerfen weitere Tasks in derselben Gruppe starten.
+///
+/// # Example
+/// ```c++
+/// ThreadPool pool(4);
+/// TaskGroup group(pool);
+/// group.run([] { /* ... */ });
+/// group.wait();
+/// ```
+class TaskGroup {
+public:
+  explicit TaskGroup(ThreadPool &pool) : pool{pool} {}
+
+  TaskGroup(const TaskGroup &) = delete;
+
+  ~TaskGroup() { wait(); }
+
+  template <typename F> void run(F &&f) {
+    pending.fetch_add(1, std::memory_order_relaxed);
+    pool.submit([this, f = std::forward<F>(f)]() mutable {
+      f();
+      pending.fetch_sub(1, std::memory_order_release);
+    });
+  }
+
+  /// Wartet, bis alle Tasks der Gruppe beendet sind, und hilft dabei mit.
+  void wait() {
+    while (pending.load(std::memory_order_acquire) != 0) {
+      if (!pool.run_one()) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  ThreadPool &get_pool() const { return pool; }
+
+private:
+  ThreadPool &pool;
+  std::atomic<size_t> pending{0};
+};
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,384 @@
+#ifndef UNROLLED_LIST_HPP
+#define UNROLLED_LIST_HPP
+
+#include "allocator.hpp"
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// Knoten einer `BasicUnrolledList`: Ein Block belegt genau eine Cache-Line
+/// und speichert so viele Werte, wie neben Zeiger und Fuellstand hineinpassen.
+template <typename V, size_t CacheLine = 64>
+struct alignas(CacheLine) UnrolledBlock {
+  static constexpr size_t header_size = sizeof(void *) + sizeof(uint32_t);
+  static constexpr size_t capacity =
+      CacheLine > header_size + sizeof(V) ? (CacheLine - header_size) / sizeof(V)
+                                          : 1;
+
+  UnrolledBlock *next{nullptr};
+  uint32_t count{0};
+  V values[capacity];
+
+  bool full() const { return count == capacity; }
+};
+
+/// Entrollte, einfach verkettete Liste mit derselben oeffentlichen
+/// Schnittstelle wie `BasicList`. Statt eines Wertes pro Knoten speichert
+/// jeder Knoten einen Block von Werten, so dass beim Durchlaufen nur ein
+/// Cache-Miss pro Block statt pro Element anfaellt. Jeder Block der Liste
+/// enthaelt mindestens einen Wert. Da Werte innerhalb und zwischen Bloecken
+/// verschoben werden, muss `T` default-konstruierbar und verschiebbar sein.
+template <typename T = int, typename Compare = std::less<T>,
+          typename Allocator = ArenaAllocator<UnrolledBlock<T>>>
+class BasicUnrolledList {
+public:
+  using Value = T;
+  using Block = UnrolledBlock<Value>;
+
+  /// Erzeugt eine leere Liste
+  BasicUnrolledList() : BasicUnrolledList(std::make_shared<Allocator>()) {}
+
+  /// Erzeugt eine leere Liste, die ihre Bloecke aus `allocator` bezieht und
+  /// mit `compare` vergleicht.
+  explicit BasicUnrolledList(std::shared_ptr<Allocator> allocator,
+                             Compare compare = Compare{})
+      : allocator{std::move(allocator)}, compare{std::move(compare)} {}
+
+  BasicUnrolledList(BasicUnrolledList &) = delete;
+
+  ~BasicUnrolledList() { clear(); }
+
+  /// Entfernt alle Elemente der Liste (siehe `BasicList::clear`).
+  void clear() {
+    if constexpr (Allocator::supports_reset &&
+                  std::is_trivially_destructible_v<Value>) {
+      if (allocator.use_count() == 1 && allocator->is_root()) {
+        allocator->reset();
+        first = last = nullptr;
+        num_items = 0;
+        return;
+      }
+    }
+    while (first) {
+      first = release_block(first);
+    }
+    last = nullptr;
+    num_items = 0;
+  }
+
+  bool empty() const { return num_items == 0; }
+
+  size_t size() const { return num_items; }
+
+  /// Haengt ein Element mit Wert `val` vorn an die Liste an.
+  void push_front(Value val) {
+    if (!first || first->full()) {
+      Block *block = new_block();
+      block->next = first;
+      first = block;
+      if (!last) {
+        last = block;
+      }
+    }
+    for (uint32_t i = first->count; i > 0; --i) {
+      first->values[i] = std::move(first->values[i - 1]);
+    }
+    first->values[0] = std::move(val);
+    first->count++;
+    num_items++;
+  }
+
+  /// Haengt ein Element mit Wert `val` hinten an die Liste an.
+  void push_back(Value val) {
+    if (!last || last->full()) {
+      append_block(new_block());
+    }
+    last->values[last->count++] = std::move(val);
+    num_items++;
+  }
+
+  /// Entfernt das erste Element der Liste und gibt seinen Wert zurueck. Die
+  /// Liste darf nicht leer sein.
+  Value pop_front() {
+    assert(!empty());
+    Value val = std::move(first->values[0]);
+    for (uint32_t i = 1; i < first->count; ++i) {
+      first->values[i - 1] = std::move(first->values[i]);
+    }
+    if (--first->count == 0) {
+      first = release_block(first);
+      if (!first) {
+        last = nullptr;
+      }
+    }
+    num_items--;
+    return val;
+  }
+
+  /// Ruft `cb` fuer jedes Element der Liste auf (siehe `BasicList::foreach`).
+  template <typename Callback> void foreach (Callback &&cb) const {
+    for (const Block *block = first; block; block = block->next) {
+      for (uint32_t i = 0; i < block->count; ++i) {
+        cb(block->values[i]);
+      }
+    }
+  }
+
+  friend std::ostream &operator<<(std::ostream &stream,
+                                  const BasicUnrolledList &list) {
+    stream << '[';
+    bool first_element = true;
+    list.foreach ([&](const Value &value) {
+      if (!first_element)
+        stream << ", ";
+      first_element = false;
+      stream << value;
+    });
+    stream << ']';
+    return stream;
+  }
+
+  /// Verschiebt alle Elemente, fuer die `predicate` `true` zurueckgibt, an
+  /// das Ende von `append_to_if_true` (siehe `BasicList::move_into_if`). Die
+  /// verbleibenden Werte werden innerhalb ihres Blocks nach vorn geschoben;
+  /// leere Bloecke werden freigegeben.
+  template <typename Predicate>
+  void move_into_if(BasicUnrolledList &append_to_if_true,
+                    Predicate &&predicate) {
+    const size_t initial_size = size() + append_to_if_true.size();
+    (void)initial_size;
+
+    Block *before = nullptr;
+    Block *block = first;
+    while (block) {
+      uint32_t kept = 0;
+      for (uint32_t i = 0; i < block->count; ++i) {
+        if (predicate(std::as_const(block->values[i]))) {
+          append_to_if_true.push_back(std::move(block->values[i]));
+        } else if (kept != i) {
+          block->values[kept++] = std::move(block->values[i]);
+        } else {
+          ++kept;
+        }
+      }
+      num_items -= block->count - kept;
+      block->count = kept;
+
+      Block *next = block->next;
+      if (kept == 0) {
+        (before ? before->next : first) = release_block(block);
+      } else {
+        before = block;
+      }
+      block = next;
+    }
+    last = before;
+
+    assert(size() + append_to_if_true.size() == initial_size);
+  }
+
+  /// Haengt die uebergebene Liste in O(1) an; `other` wird dabei geleert.
+  void concat(BasicUnrolledList &other) {
+    if (other.empty()) {
+      return;
+    }
+    if (other.allocator != allocator) {
+      allocator->merge(*other.allocator);
+    }
+
+    (last ? last->next : first) = other.first;
+    last = other.last;
+    num_items += other.num_items;
+
+    other.first = other.last = nullptr;
+    other.num_items = 0;
+  }
+
+  bool is_sorted() const {
+    const Value *prev = nullptr;
+    for (const Block *block = first; block; block = block->next) {
+      for (uint32_t i = 0; i < block->count; ++i) {
+        if (prev && less(block->values[i], *prev)) {
+          return false;
+        }
+        prev = &block->values[i];
+      }
+    }
+    return true;
+  }
+
+  /// Sortiert die Liste stabil und gibt die Anzahl der Vergleiche zurueck.
+  ///
+  /// Zunaechst werden alle Bloecke aufgefuellt und jeder Block per
+  /// Insertion Sort sortiert. Danach werden Laeufe aus 1, 2, 4, ... Bloecken
+  /// bottom-up verschmolzen. Die Ausgabebloecke stammen aus der Freiliste
+  /// des Allokators, in die die verbrauchten Eingabebloecke zurueckfliessen.
+  uint64_t sort() {
+    uint64_t comparisons = 0;
+    if (size() <= 1) {
+      return comparisons;
+    }
+
+    pack();
+
+    size_t num_blocks = 0;
+    for (Block *block = first; block; block = block->next) {
+      insertion_sort(*block, comparisons);
+      ++num_blocks;
+    }
+
+    for (size_t width = 1; width < num_blocks; width *= 2) {
+      Block *rest = first;
+      first = last = nullptr;
+      while (rest) {
+        Block *left = rest;
+        Block *right = split_blocks_after(left, width);
+        rest = split_blocks_after(right, width);
+        if (right) {
+          merge_runs(left, right, comparisons);
+        } else {
+          append_block(left);
+          while (last->next) {
+            last = last->next;
+          }
+        }
+      }
+    }
+
+    return comparisons;
+  }
+
+private:
+  Block *first{nullptr};
+  Block *last{nullptr};
+  size_t num_items{0};
+  std::shared_ptr<Allocator> allocator;
+  Compare compare;
+
+  bool less(const Value &a, const Value &b) const { return compare(a, b); }
+
+  Block *new_block() { return new (allocator->allocate()) Block(); }
+
+  /// Gibt `block` frei und liefert seinen Nachfolger zurueck.
+  Block *release_block(Block *block) {
+    Block *next = block->next;
+    block->~Block();
+    allocator->deallocate(block);
+    return next;
+  }
+
+  void append_block(Block *block) {
+    (last ? last->next : first) = block;
+    last = block;
+  }
+
+  /// Haengt einen Wert an den letzten Block an und legt bei Bedarf einen
+  /// neuen Block an. `num_items` bleibt unveraendert.
+  void emit(Value &val) {
+    if (!last || last->full()) {
+      append_block(new_block());
+    }
+    last->values[last->count++] = std::move(val);
+  }
+
+  /// Fuellt alle Bloecke bis auf den letzten vollstaendig auf und gibt die
+  /// dadurch frei gewordenen Bloecke zurueck.
+  void pack() {
+    Block *write = first;
+    uint32_t write_idx = 0;
+    for (Block *read = first; read; read = read->next) {
+      for (uint32_t i = 0; i < read->count; ++i) {
+        if (write_idx == Block::capacity) {
+          write->count = Block::capacity;
+          write = write->next;
+          write_idx = 0;
+        }
+        if (write != read || write_idx != i) {
+          write->values[write_idx] = std::move(read->values[i]);
+        }
+        ++write_idx;
+      }
+    }
+    write->count = write_idx;
+
+    Block *unused = write->next;
+    write->next = nullptr;
+    last = write;
+    while (unused) {
+      unused = release_block(unused);
+    }
+  }
+
+  void insertion_sort(Block &block, uint64_t &comparisons) const {
+    for (uint32_t i = 1; i < block.count; ++i) {
+      Value val = std::move(block.values[i]);
+      uint32_t j = i;
+      while (j > 0) {
+        ++comparisons;
+        if (!less(val, block.values[j - 1])) {
+          break;
+        }
+        block.values[j] = std::move(block.values[j - 1]);
+        --j;
+      }
+      block.values[j] = std::move(val);
+    }
+  }
+
+  /// Trennt die Blockkette hinter den ersten `n` Bloecken ab.
+  static Block *split_blocks_after(Block *block, size_t n) {
+    for (size_t i = 1; block && i < n; ++i) {
+      block = block->next;
+    }
+    if (!block) {
+      return nullptr;
+    }
+    Block *rest = block->next;
+    block->next = nullptr;
+    return rest;
+  }
+
+  /// Verschmilzt die sortierten Blockketten `left` und `right` stabil an das
+  /// Ende der Liste. Verbrauchte Eingabebloecke werden sofort freigegeben.
+  void merge_runs(Block *left, Block *right, uint64_t &comparisons) {
+    uint32_t left_idx = 0;
+    uint32_t right_idx = 0;
+
+    while (left && right) {
+      ++comparisons;
+      if (less(right->values[right_idx], left->values[left_idx])) {
+        emit(right->values[right_idx]);
+        if (++right_idx == right->count) {
+          right = release_block(right);
+          right_idx = 0;
+        }
+      } else {
+        emit(left->values[left_idx]);
+        if (++left_idx == left->count) {
+          left = release_block(left);
+          left_idx = 0;
+        }
+      }
+    }
+
+    Block *rest = left ? left : right;
+    uint32_t rest_idx = left ? left_idx : right_idx;
+    while (rest) {
+      for (; rest_idx < rest->count; ++rest_idx) {
+        emit(rest->values[rest_idx]);
+      }
+      rest = release_block(rest);
+      rest_idx = 0;
+    }
+  }
+};
+
+/// Entrollte Liste von ints mit Arena-Allokator (Standard).
+using UnrolledList = BasicUnrolledList<>;
+
+#endif // UNROLLED_LIST_HPP
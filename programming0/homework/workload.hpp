@@ -0,0 +1,99 @@
+#ifndef WORKLOAD_HPP
+#define WORKLOAD_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+/// Namen aller Eingabeformen, die `make_input` erzeugen kann.
+inline const std::array<const char *, 10> workload_shapes = {
+    "random",   "sorted",   "reversed",    "organ-pipe", "sawtooth",
+    "k-sorted", "few-uniques", "zipf",     "random-dup", "sorted-tail"};
+
+inline bool is_known_shape(const std::string &shape) {
+  return std::find(workload_shapes.begin(), workload_shapes.end(), shape) !=
+         workload_shapes.end();
+}
+
+/// Erzeugt eine Eingabe der Laenge n mit der angegebenen Form. Alle
+/// Zufallsentscheidungen stammen aus `gen`, so dass die Eingaben bei festem
+/// Seed reproduzierbar sind.
+///
+/// - "random": zufaellige Permutation von 0, ..., n-1
+/// - "sorted", "reversed": aufsteigend bzw. absteigend sortiert
+/// - "organ-pipe": aufsteigend, dann absteigend
+/// - "sawtooth": aufsteigende Laeufe der Laenge ~sqrt(n)
+/// - "k-sorted": jedes Element liegt hoechstens 16 Positionen neben seiner
+///   sortierten Position
+/// - "few-uniques": zufaellig, nur 16 verschiedene Werte
+/// - "zipf": Zipf-verteilte Werte (Exponent 1) ueber n Raenge; wenige Werte
+///   kommen sehr haeufig vor
+/// - "random-dup": n gleichverteilte Werte aus 0, ..., n-1 mit Zuruecklegen
+///   (etwa ein Drittel Duplikate)
+/// - "sorted-tail": sortiert bis auf die letzten n/16 Elemente, die
+///   gleichverteilt zufaellig sind (sortierter Bestand mit angehaengten
+///   neuen Daten)
+inline std::vector<int> make_input(const std::string &shape, size_t n,
+                                   std::mt19937_64 &gen) {
+  std::vector<int> values(n);
+  std::iota(values.begin(), values.end(), 0);
+
+  if (shape == "random") {
+    std::shuffle(values.begin(), values.end(), gen);
+  } else if (shape == "reversed") {
+    std::reverse(values.begin(), values.end());
+  } else if (shape == "organ-pipe") {
+    for (size_t i = 0; i < n; ++i) {
+      values[i] = static_cast<int>(std::min(i, n - 1 - i));
+    }
+  } else if (shape == "sawtooth") {
+    const auto period = std::max<size_t>(
+        static_cast<size_t>(std::sqrt(static_cast<double>(n))), 1);
+    for (size_t i = 0; i < n; ++i) {
+      values[i] = static_cast<int>(i % period);
+    }
+  } else if (shape == "k-sorted") {
+    constexpr size_t k = 16;
+    for (size_t block = 0; block < n; block += k) {
+      std::shuffle(values.begin() + block,
+                   values.begin() + std::min(block + k, n), gen);
+    }
+  } else if (shape == "few-uniques") {
+    for (auto &x : values) {
+      x %= 16;
+    }
+    std::shuffle(values.begin(), values.end(), gen);
+  } else if (shape == "zipf") {
+    std::vector<double> cdf(n);
+    double total = 0;
+    for (size_t rank = 0; rank < n; ++rank) {
+      total += 1.0 / static_cast<double>(rank + 1);
+      cdf[rank] = total;
+    }
+    std::uniform_real_distribution<double> uniform(0, total);
+    for (auto &x : values) {
+      const auto rank =
+          std::upper_bound(cdf.begin(), cdf.end(), uniform(gen)) - cdf.begin();
+      x = static_cast<int>(std::min<size_t>(rank, n - 1));
+    }
+  } else if (shape == "random-dup") {
+    std::uniform_int_distribution<int> uniform(0, static_cast<int>(n) - 1);
+    for (auto &x : values) {
+      x = uniform(gen);
+    }
+  } else if (shape == "sorted-tail") {
+    std::uniform_int_distribution<int> uniform(0, static_cast<int>(n) - 1);
+    for (size_t i = n - n / 16; i < n; ++i) {
+      values[i] = uniform(gen);
+    }
+  }
+
+  return values;
+}
+
+#endif // WORKLOAD_HPP